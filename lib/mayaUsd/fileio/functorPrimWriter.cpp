@@ -83,6 +83,15 @@ UsdMaya_FunctorPrimWriter::ShouldPruneChildren() const
     return _pruneChildren;
 }
 
+/* virtual */
+bool
+UsdMaya_FunctorPrimWriter::IsAnimated() const
+{
+    // We can't know what the plugin function writes, so it always gets
+    // called for every time sample.
+    return true;
+}
+
 /* virtual */
 const SdfPathVector&
 UsdMaya_FunctorPrimWriter::GetModelPaths() const
@@ -51,6 +51,7 @@ public:
     void Write(const UsdTimeCode& usdTime) override;
     bool ExportsGprims() const override;
     bool ShouldPruneChildren() const override;
+    bool IsAnimated() const override;
     const SdfPathVector& GetModelPaths() const override;
 
     static UsdMayaPrimWriterSharedPtr Create(
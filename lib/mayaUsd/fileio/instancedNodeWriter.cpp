@@ -207,6 +207,15 @@ UsdMaya_InstancedNodeWriter::ShouldPruneChildren() const
     return true;
 }
 
+/* virtual */
+bool
+UsdMaya_InstancedNodeWriter::IsAnimated() const
+{
+    // The instance master's own writers carry the animation; Write() doesn't
+    // author anything.
+    return false;
+}
+
 /* virtual */
 const SdfPathVector&
 UsdMaya_InstancedNodeWriter::GetModelPaths() const
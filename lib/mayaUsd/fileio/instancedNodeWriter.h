@@ -42,6 +42,7 @@ public:
 
     bool ExportsGprims() const override;
     bool ShouldPruneChildren() const override;
+    bool IsAnimated() const override;
     const SdfPathVector& GetModelPaths() const override;
     const UsdMayaUtil::MDagPathMap<SdfPath>&
             GetDagToUsdPathMapping() const override;
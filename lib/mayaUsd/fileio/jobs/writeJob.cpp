@@ -413,6 +413,26 @@ UsdMaya_WriteJob::_BeginWriting(const std::string& fileName, bool append)
         return false;
     }
 
+    // Partition the prim writers up front so that only the ones with
+    // animated inputs get visited per frame. This includes any writers that
+    // were created for instance masters during the traversal.
+    mAnimatedPrimWriters.clear();
+    if (!mJobCtx.mArgs.timeSamples.empty()) {
+        for (const UsdMayaPrimWriterSharedPtr& primWriter :
+                mJobCtx.mMayaPrimWriterList) {
+            if (primWriter->GetUsdPrim() && primWriter->IsAnimated()) {
+                mAnimatedPrimWriters.push_back(primWriter);
+            }
+        }
+
+        if (mJobCtx.mArgs.verbose) {
+            TF_STATUS(
+                "%zu of %zu prim writers are animated",
+                mAnimatedPrimWriters.size(),
+                mJobCtx.mMayaPrimWriterList.size());
+        }
+    }
+
     // now we populate the chasers and run export default
     mChasers.clear();
     UsdMayaChaserRegistry::FactoryContext ctx(mJobCtx.mStage, mDagPathToUsdPathMap, mJobCtx.mArgs);
@@ -441,11 +461,8 @@ UsdMaya_WriteJob::_WriteFrame(double iFrame)
     const UsdTimeCode usdTime(iFrame);
 
     for (const UsdMayaPrimWriterSharedPtr& primWriter :
-            mJobCtx.mMayaPrimWriterList) {
-        const UsdPrim& usdPrim = primWriter->GetUsdPrim();
-        if (usdPrim) {
-            primWriter->Write(usdTime);
-        }
+            mAnimatedPrimWriters) {
+        primWriter->Write(usdTime);
     }
 
     for (UsdMayaChaserRefPtr& chaser : mChasers) {
@@ -551,6 +568,7 @@ UsdMaya_WriteJob::_FinishWriting()
 
     mJobCtx.mStage = UsdStageRefPtr();
     mJobCtx.mMayaPrimWriterList.clear(); // clear this so that no stage references are left around
+    mAnimatedPrimWriters.clear();
 
     // In the usdz case, the layer at _fileName was just a temp file, so
     // clean it up now. Do this after mJobCtx.mStage is reset to ensure
@@ -17,6 +17,7 @@
 #define PXRUSDMAYA_WRITE_JOB_H
 
 #include <string>
+#include <vector>
 
 #include <maya/MObjectHandle.h>
 
@@ -25,6 +26,7 @@
 
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/fileio/chaser/chaser.h>
+#include <mayaUsd/fileio/primWriter.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
 
@@ -94,6 +96,11 @@ private:
 
     UsdMayaChaserRefPtrVector mChasers;
 
+    // Subset of the job context's prim writers that need to be visited at
+    // every time sample. Computed once in _BeginWriting() so that writers for
+    // static Maya nodes are skipped by _WriteFrame().
+    std::vector<UsdMayaPrimWriterSharedPtr> mAnimatedPrimWriters;
+
     UsdMayaWriteJobContext mJobCtx;
 
     std::unique_ptr<UsdMaya_ModelKindProcessor> _modelKindProcessor;
@@ -43,6 +43,7 @@
 #include <mayaUsd/fileio/jobs/jobArgs.h>
 #include <mayaUsd/fileio/translators/translatorGprim.h>
 #include <mayaUsd/fileio/utils/adaptor.h>
+#include <mayaUsd/fileio/utils/userTaggedAttribute.h>
 #include <mayaUsd/fileio/utils/writeUtil.h>
 #include <mayaUsd/fileio/writeJobContext.h>
 #include <mayaUsd/utils/util.h>
@@ -235,6 +236,47 @@ UsdMayaPrimWriter::ExportsGprims() const
     return false;
 }
 
+/* virtual */
+bool
+UsdMayaPrimWriter::IsAnimated() const
+{
+    if (_HasAnimCurves()) {
+        return true;
+    }
+
+    // When merging transforms and shapes, the shape writer authors the
+    // combined visibility of the shape and its parent transform (see
+    // Write()), so it must also be visited when only the parent's visibility
+    // is animated.
+    if (_exportVisibility &&
+            !_GetExportArgs().timeSamples.empty() &&
+            _IsMergedShape()) {
+        MDagPath parentDagPath = GetDagPath();
+        parentDagPath.pop();
+        const MFnDependencyNode parentDepNodeFn(parentDagPath.node());
+        if (UsdMayaUtil::isPlugAnimated(
+                parentDepNodeFn.findPlug("visibility"))) {
+            return true;
+        }
+    }
+
+    // UsdMayaWriteUtil::SetUsdAttr() only writes user-exported attributes
+    // driven by a connection at non-default times, even when nothing upstream
+    // is time dependent, so they must not be culled.
+    if (!_GetExportArgs().timeSamples.empty()) {
+        const std::vector<UsdMayaUserTaggedAttribute> exportedAttributes =
+            UsdMayaUserTaggedAttribute::GetUserTaggedAttributesForNode(
+                GetMayaObject());
+        for (const UsdMayaUserTaggedAttribute& attr : exportedAttributes) {
+            if (attr.GetMayaPlug().isDestination()) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 /* virtual */
 bool
 UsdMayaPrimWriter::ShouldPruneChildren() const
@@ -101,6 +101,22 @@ public:
     MAYAUSD_CORE_PUBLIC
     virtual bool ShouldPruneChildren() const;
 
+    /// Whether this prim writer needs to be visited at every time sample of
+    /// an animated export.
+    /// The write job partitions its prim writers up front using this, and
+    /// only calls Write() at non-default times for writers that return
+    /// \c true. Writers for which this returns \c false are still written
+    /// once at the default time.
+    ///
+    /// Base implementation returns whether the Maya node has upstream
+    /// animation (see _HasAnimCurves()), also accounting for the parent
+    /// transform's visibility when transforms and shapes are merged. Prim
+    /// writers that author time-varying data from sources not covered by
+    /// that analysis (e.g. world-space or simulation data) should override
+    /// to return \c true to opt out of per-frame culling.
+    MAYAUSD_CORE_PUBLIC
+    virtual bool IsAnimated() const;
+
     /// Whether visibility can be exported for this prim.
     /// By default, this is based off of the export visibility setting in the
     /// export args.
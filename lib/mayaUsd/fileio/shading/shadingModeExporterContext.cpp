@@ -19,14 +19,16 @@
 #include <utility>
 
 #include <maya/MDagPath.h>
-#include <maya/MDagPathArray.h>
 #include <maya/MDGContext.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnDependencyNode.h>
+#include <maya/MFnMesh.h>
+#include <maya/MIntArray.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MNamespace.h>
 #include <maya/MObject.h>
 #include <maya/MObjectArray.h>
+#include <maya/MObjectHandle.h>
 #include <maya/MPlug.h>
 #include <maya/MStatus.h>
 #include <maya/MString.h>
@@ -221,65 +223,31 @@ UsdMayaShadingModeExportContext::GetDisplacementShader() const
 UsdMayaShadingModeExportContext::AssignmentVector
 UsdMayaShadingModeExportContext::GetAssignments() const
 {
-    AssignmentVector ret;
-
-    MStatus status;
-    MFnDependencyNode seDepNode(_shadingEngine, &status);
-    if (!status) {
-        return ret;
+    if (!_assignmentIndexBuilt) {
+        _BuildAssignmentIndex();
     }
 
-    MPlug dsmPlug = seDepNode.findPlug("dagSetMembers", true, &status);
-    if (!status) {
-        return ret;
+    auto iter = _assignmentIndex.find(MObjectHandle(_shadingEngine));
+    if (iter == _assignmentIndex.end()) {
+        return AssignmentVector();
     }
+    return iter->second;
+}
 
-    SdfPathSet seenBoundPrimPaths;
-    for (unsigned int i = 0; i < dsmPlug.numConnectedElements(); i++) {
-        MPlug dsmElemPlug(dsmPlug.connectionByPhysicalIndex(i));
-        MStatus status = MS::kFailure;
-        MPlug connectedPlug = UsdMayaUtil::GetConnected(dsmElemPlug);
-
-        // Maya connects shader bindings for instances based on element indices
-        // of the instObjGroups[x] or instObjGroups[x].objectGroups[y] plugs.
-        // The instance number is the index of instObjGroups[x]; the face set
-        // (if any) is the index of objectGroups[y].
-        if (connectedPlug.isElement() && connectedPlug.array().isChild()) {
-            // connectedPlug is instObjGroups[x].objectGroups[y] (or its
-            // equivalent), so go up two levels to get to instObjGroups[x].
-            MPlug objectGroups = connectedPlug.array();
-            MPlug instObjGroupsElem = objectGroups.parent();
-            connectedPlug = instObjGroupsElem;
-        }
-        // connectedPlug should be instObjGroups[x] here. Get the index.
-        unsigned int instanceNumber = connectedPlug.logicalIndex();
-
-        // Get the correct DAG path for this instance number.
-        MDagPathArray allDagPaths;
-        MDagPath::getAllPathsTo(connectedPlug.node(), allDagPaths);
-        if (instanceNumber >= allDagPaths.length()) {
-            TF_RUNTIME_ERROR(
-                    "Instance number is %d (from plug '%s') but node only has "
-                    "%d paths",
-                    instanceNumber,
-                    connectedPlug.name().asChar(),
-                    allDagPaths.length());
-            continue;
-        }
-
-        MDagPath dagPath = allDagPaths[instanceNumber];
-        TF_VERIFY(dagPath.instanceNumber() == instanceNumber);
-        MFnDagNode dagNode(dagPath, &status);
-        if (!status) {
-            continue;
-        }
-
-        auto iter = _dagPathToUsdMap.find(dagPath);
-        if (iter == _dagPathToUsdMap.end()) {
-            // Geometry w/ this material bound doesn't seem to exist in USD.
-            continue;
-        }
-        SdfPath usdPath = iter->second;
+void
+UsdMayaShadingModeExportContext::_BuildAssignmentIndex() const
+{
+    // Rather than walking the members of each shading engine, which queries
+    // the sets of every member shape once per shading engine, walk the
+    // exported shapes once and record the assignments of each of them in
+    // the index of its shading engines.
+    _assignmentIndex.clear();
+    _assignmentIndexBuilt = true;
+
+    UsdMayaUtil::MObjectHandleUnorderedMap<SdfPathSet> seenBoundPrimPaths;
+    for (const auto& dagPathAndUsdPath : _dagPathToUsdMap) {
+        const MDagPath& dagPath = dagPathAndUsdPath.first;
+        SdfPath usdPath = dagPathAndUsdPath.second;
 
         // If usdModelRootOverridePath is not empty, replace the
         // root namespace with it.
@@ -289,11 +257,6 @@ UsdMayaShadingModeExportContext::GetAssignments() const
                 GetExportArgs().usdModelRootOverridePath);
         }
 
-        // If this path has already been processed, skip it.
-        if (!seenBoundPrimPaths.insert(usdPath).second) {
-            continue;
-        }
-
         // If the bound prim's path is not below a bindable root, skip it.
         if (SdfPathFindLongestPrefix(
 #if USD_VERSION_NUM >= 1911
@@ -306,34 +269,85 @@ UsdMayaShadingModeExportContext::GetAssignments() const
             continue;
         }
 
+        MStatus status;
+        MFnDagNode dagNode(dagPath, &status);
+        if (!status) {
+            continue;
+        }
+
+        // Maya connects shader bindings for instances based on element
+        // indices of the instObjGroups[x] plugs, where x is the instance
+        // number of the Dag path.
         MObjectArray sgObjs, compObjs;
         status = dagNode.getConnectedSetsAndMembers(
-            instanceNumber,
+            dagPath.instanceNumber(),
             sgObjs,
             compObjs,
             true);
-        if (status != MS::kSuccess) {
+        if (status != MS::kSuccess || sgObjs.length() == 0u) {
             continue;
         }
 
+        // Gather the face indices of all the per-face assignments of a mesh
+        // in one call, rather than iterating over the faces of each
+        // component.
+        MObjectArray faceShadingEngines;
+        MIntArray faceShadingEngineIndices;
         for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
-            // If the shading group isn't the one we're interested in, skip it.
-            if (sgObjs[j] != _shadingEngine) {
+            if (!compObjs[j].isNull() && dagPath.hasFn(MFn::kMesh)) {
+                MFnMesh meshFn(dagPath, &status);
+                if (status) {
+                    meshFn.getConnectedShaders(
+                        dagPath.instanceNumber(),
+                        faceShadingEngines,
+                        faceShadingEngineIndices);
+                }
+                break;
+            }
+        }
+
+        for (unsigned int j = 0u; j < sgObjs.length(); ++j) {
+            const MObjectHandle shadingEngine(sgObjs[j]);
+
+            // If this path has already been processed for this shading
+            // engine, skip it.
+            if (!seenBoundPrimPaths[shadingEngine].insert(usdPath).second) {
                 continue;
             }
 
             VtIntArray faceIndices;
             if (!compObjs[j].isNull()) {
-                MItMeshPolygon faceIt(dagPath, compObjs[j]);
-                faceIndices.reserve(faceIt.count());
-                for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
-                    faceIndices.push_back(faceIt.index());
+                int faceShadingEngineIndex = -1;
+                for (unsigned int k = 0u; k < faceShadingEngines.length(); ++k) {
+                    if (faceShadingEngines[k] == sgObjs[j]) {
+                        faceShadingEngineIndex = static_cast<int>(k);
+                        break;
+                    }
+                }
+
+                if (faceShadingEngineIndex >= 0) {
+                    const unsigned int numFaces =
+                        faceShadingEngineIndices.length();
+                    for (unsigned int face = 0u; face < numFaces; ++face) {
+                        if (faceShadingEngineIndices[face] ==
+                                faceShadingEngineIndex) {
+                            faceIndices.push_back(static_cast<int>(face));
+                        }
+                    }
+                }
+                else {
+                    MItMeshPolygon faceIt(dagPath, compObjs[j]);
+                    faceIndices.reserve(faceIt.count());
+                    for (faceIt.reset(); !faceIt.isDone(); faceIt.next()) {
+                        faceIndices.push_back(faceIt.index());
+                    }
                 }
             }
-            ret.push_back(std::make_pair(usdPath, faceIndices));
+
+            _assignmentIndex[shadingEngine].push_back(
+                std::make_pair(usdPath, faceIndices));
         }
     }
-    return ret;
 }
 
 static
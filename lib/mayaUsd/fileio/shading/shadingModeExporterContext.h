@@ -101,6 +101,10 @@ public:
 
     /// Returns a vector of binding assignments associated with the shading
     /// engine.
+    ///
+    /// The assignments of all the shading engines are gathered in a single
+    /// pass over the exported shapes the first time this is called, and are
+    /// then reused for the other shading engines exported with this context.
     MAYAUSD_CORE_PUBLIC
     AssignmentVector GetAssignments() const;
 
@@ -138,6 +142,8 @@ public:
             const UsdMayaUtil::MDagPathMap<SdfPath>& dagPathToUsdMap);
 
 private:
+    void _BuildAssignmentIndex() const;
+
     MObject _shadingEngine;
     const UsdStageRefPtr& _stage;
     const UsdMayaUtil::MDagPathMap<SdfPath>& _dagPathToUsdMap;
@@ -149,6 +155,12 @@ private:
     /// Shaders that are bound to prims under \p _bindableRoot paths will get
     /// exported. If \p bindableRoots is empty, it will export all.
     SdfPathSet _bindableRoots;
+
+    /// Binding assignments of every shading engine, indexed by shading
+    /// engine. Built on demand by GetAssignments().
+    mutable UsdMayaUtil::MObjectHandleUnorderedMap<AssignmentVector>
+        _assignmentIndex;
+    mutable bool _assignmentIndexBuilt = false;
 };
 
 
@@ -471,5 +471,28 @@ UsdMayaTransformWriter::Write(const UsdTimeCode& usdTime)
     }
 }
 
+/* virtual */
+bool
+UsdMayaTransformWriter::IsAnimated() const
+{
+    if (UsdMayaPrimWriter::IsAnimated()) {
+        return true;
+    }
+
+    // _PushTransformStack() uses UsdMayaUtil::getSampledType(), which reports
+    // any connected channel as animated, while the base class only considers
+    // time dependent inputs. Animated channels are only ever written at
+    // non-default times, so they must not be culled.
+    for (const _AnimChannel& animChannel : _animChannels) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            if (animChannel.sampleType[i] == _SampleType::Animated) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
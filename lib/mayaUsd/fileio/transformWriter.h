@@ -57,6 +57,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     void Write(const UsdTimeCode& usdTime) override;
 
+    /// Also returns \c true when any xform op channel is sampled per frame.
+    /// Channels with an incoming connection are sampled per frame and not
+    /// written at the default time, even if their input is not animated.
+    MAYAUSD_CORE_PUBLIC
+    bool IsAnimated() const override;
+
 private:
     using _TokenRotationMap = std::unordered_map<
             const TfToken, MEulerRotation, TfToken::HashFunctor>;
@@ -17,6 +17,10 @@
 
 #include <pxr/base/tf/staticData.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdSkel/binding.h>
+#include <pxr/usd/usdSkel/cache.h>
 #include <pxr/usd/usdSkel/skeleton.h>
 #include <pxr/usd/usdSkel/skeletonQuery.h>
 #include <pxr/usd/usdSkel/skinningQuery.h>
@@ -43,6 +47,11 @@
 #include <mayaUsd/fileio/translators/translatorXformable.h>
 #include <mayaUsd/utils/util.h>
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <tuple>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -207,82 +216,95 @@ _SetAnimPlugData(MFnDependencyNode& depNode,
 }
 
 
+/// Translate, rotate and scale channels of a transform, holding the
+/// decomposed transform at each time sample.
+struct _TransformChannels
+{
+    std::vector<double> translates[3];
+    std::vector<double> rotates[3];
+    std::vector<double> scales[3];
+    bool decomposed = false;
+};
+
+
+/// Decompose the transforms of \p xforms into \p channels.
+/// This does not touch any Maya node, so it may run on worker threads.
+void
+_DecomposeTransforms(const std::vector<GfMatrix4d>& xforms,
+                     _TransformChannels* channels)
+{
+    const size_t numSamples = xforms.size();
+
+    for (int c = 0; c < 3; ++c) {
+        channels->translates[c].assign(numSamples, 0.0);
+        channels->rotates[c].assign(numSamples, 0.0);
+        channels->scales[c].assign(numSamples, 1.0);
+    }
+    channels->decomposed = false;
+
+    for (size_t i = 0; i < numSamples; ++i) {
+        GfVec3d t, r, s;
+        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(
+               xforms[i], &t, &r, &s)) {
+            for (int c = 0 ; c < 3; ++c) {
+                channels->translates[c][i] = t[c];
+                channels->rotates[c][i] = r[c];
+                channels->scales[c][i] = s[c];
+            }
+            channels->decomposed = true;
+        }
+    }
+}
+
+
 /// Set animation on \p transformNode.
-/// The \p xforms holds transforms at each time, while the \p times
-/// array holds the corresponding times.
+/// The \p channels hold the decomposed transform at each time, while the
+/// \p times array holds the corresponding times.
 bool
 _SetTransformAnim(MFnDependencyNode& transformNode,
-                  const std::vector<GfMatrix4d>& xforms,
+                  const _TransformChannels& channels,
                   MTimeArray& times,
                   const UsdMayaPrimReaderContext* context)
 {
-    if (xforms.size() != times.length()) {
+    const size_t numChannelSamples = channels.translates[0].size();
+    if (numChannelSamples != times.length()) {
         TF_WARN("xforms size [%zu] != times size [%du].",
-                xforms.size(), times.length());
+                numChannelSamples, times.length());
         return false;
     }
-    if (xforms.empty())
+    if (numChannelSamples == 0)
         return true;
 
-    MStatus status;
-
     const unsigned int numSamples = times.length();
 
     if (numSamples > 1) {
-        MDoubleArray translates[3] = {
-            MDoubleArray(numSamples),
-            MDoubleArray(numSamples),   
-            MDoubleArray(numSamples)
-        };
-        MDoubleArray rotates[3] = {
-            MDoubleArray(numSamples),
-            MDoubleArray(numSamples),
-            MDoubleArray(numSamples)
-        };
-        MDoubleArray scales[3] = {
-            MDoubleArray(numSamples, 1),
-            MDoubleArray(numSamples, 1),
-            MDoubleArray(numSamples, 1)
-        };
-
-        // Decompose all transforms.
-        for (unsigned int i = 0; i < numSamples; ++i) {
-            const auto& xform = xforms[i];
-            GfVec3d t, r, s;
-            if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(
-                   xform, &t, &r, &s)) {
-                for (int c = 0 ; c < 3; ++c) {
-                    translates[c][i] = t[c];
-                    rotates[c][i] = r[c];
-                    scales[c][i] = s[c];
-                }
-            }
-        }
-
         for (int c = 0; c < 3; ++c) {
+            // Bulk copy each channel into the arrays of the anim curves.
+            MDoubleArray translates(channels.translates[c].data(), numSamples);
+            MDoubleArray rotates(channels.rotates[c].data(), numSamples);
+            MDoubleArray scales(channels.scales[c].data(), numSamples);
+
             if (!_SetAnimPlugData(transformNode, _MayaTokens->translates[c],
-                                 translates[c], times, context) ||
+                                 translates, times, context) ||
                !_SetAnimPlugData(transformNode, _MayaTokens->rotates[c],
-                                 rotates[c], times, context) ||
+                                 rotates, times, context) ||
                !_SetAnimPlugData(transformNode, _MayaTokens->scales[c],
-                                 scales[c], times, context)) {
+                                 scales, times, context)) {
                 return false;
             }
         }
-    } else {
-        const auto& xform = xforms.front();
-        GfVec3d t, r, s;
-        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(
-               xform, &t, &r, &s)) {
-            for (int c = 0; c < 3; ++c) {
-                if (!UsdMayaUtil::setPlugValue(
-                       transformNode, _MayaTokens->translates[c], t[c]) ||
-                   !UsdMayaUtil::setPlugValue(
-                       transformNode, _MayaTokens->rotates[c], r[c]) ||
-                   !UsdMayaUtil::setPlugValue(
-                       transformNode, _MayaTokens->scales[c], s[c])) {
-                    return false;
-                }
+    } else if (channels.decomposed) {
+        for (int c = 0; c < 3; ++c) {
+            if (!UsdMayaUtil::setPlugValue(
+                   transformNode, _MayaTokens->translates[c],
+                   channels.translates[c].front()) ||
+               !UsdMayaUtil::setPlugValue(
+                   transformNode, _MayaTokens->rotates[c],
+                   channels.rotates[c].front()) ||
+               !UsdMayaUtil::setPlugValue(
+                   transformNode, _MayaTokens->scales[c],
+                   channels.scales[c].front())) {
+                return false;
             }
         }
     }
@@ -508,13 +530,48 @@ _CopyAnimFromSkel(const UsdSkelSkeletonQuery& skelQuery,
 
     MStatus status;
 
-    // Pre-sample the Skeleton's local transforms.
-    std::vector<GfMatrix4d> skelLocalXforms(usdTimes.size());
+    const size_t numSamples = usdTimes.size();
+    const UsdSkelTopology& topology = skelQuery.GetTopology();
+    const size_t numJoints = topology.GetNumJoints();
+
+    // Pre-sample the Skeleton's local transforms and all joint animation.
+    // Time samples are independent of each other, so they are computed in
+    // parallel. Only the creation of the anim curves runs on the main thread.
+    std::vector<GfMatrix4d> skelLocalXforms(numSamples);
+    std::vector<VtMatrix4dArray> samples(numSamples);
+    std::atomic<bool> sampled(true);
     UsdGeomXformable::XformQuery xfQuery(skelQuery.GetSkeleton());
-    for (size_t i = 0; i < usdTimes.size(); ++i) {
-        if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
-            skelLocalXforms[i].SetIdentity();
-        }
+    WorkParallelForN(
+        numSamples,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i],
+                                                    usdTimes[i])) {
+                    skelLocalXforms[i].SetIdentity();
+                }
+                if (!skelQuery.ComputeJointLocalTransforms(&samples[i],
+                                                           usdTimes[i]) ||
+                    samples[i].size() != numJoints) {
+                    sampled = false;
+                    return;
+                }
+                if (!jointContainerIsSkeleton) {
+                    // We do not have a node to receive the local transforms
+                    // of the Skeleton, so any local transforms on the
+                    // Skeleton must be concatened onto the root joints
+                    // instead.
+                    for (size_t j = 0; j < numJoints; ++j) {
+                        if (topology.GetParent(j) < 0) {
+                            // This is a root joint.
+                            // Concat by the local skel xform.
+                            samples[i][j] *= skelLocalXforms[i];
+                        }
+                    }
+                }
+            }
+        });
+    if (!sampled) {
+        return false;
     }
 
     if (jointContainerIsSkeleton) {
@@ -524,46 +581,40 @@ _CopyAnimFromSkel(const UsdSkelSkeletonQuery& skelQuery,
         MFnDependencyNode skelXformDep(jointContainer, &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        if (!_SetTransformAnim(skelXformDep, skelLocalXforms,
+        _TransformChannels skelChannels;
+        _DecomposeTransforms(skelLocalXforms, &skelChannels);
+
+        if (!_SetTransformAnim(skelXformDep, skelChannels,
                                mayaTimes, context)) {
             return false;
         }
     }
 
-    // Pre-sample all joint animation.
-    std::vector<VtMatrix4dArray> samples(usdTimes.size());
-    for (size_t i = 0; i < samples.size(); ++i) {
-        if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
-            return false;
-        }
-        if (!jointContainerIsSkeleton) {
-            // We do not have a node to receive the local transforms of the
-            // Skeleton, so any local transforms on the Skeleton must be
-            // concatened onto the root joints instead.
-            for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j){
-                if (skelQuery.GetTopology().GetParent(j) < 0) {
-                    // This is a root joint. Concat by the local skel xform.
-                    samples[i][j] *= skelLocalXforms[i];
+    // Decompose the transforms of every joint in parallel as well.
+    const size_t numJointNodes = std::min(jointNodes.size(), numJoints);
+    std::vector<_TransformChannels> jointChannels(numJointNodes);
+    WorkParallelForN(
+        numJointNodes,
+        [&](size_t begin, size_t end) {
+            std::vector<GfMatrix4d> xforms(numSamples);
+            for (size_t jointIdx = begin; jointIdx < end; ++jointIdx) {
+                // Get the transforms of just this joint.
+                for (size_t i = 0; i < numSamples; ++i) {
+                    xforms[i] = samples[i][jointIdx];
                 }
+                _DecomposeTransforms(xforms, &jointChannels[jointIdx]);
             }
-        }
-    }
+        });
 
     MFnDependencyNode jointDep;
 
-    std::vector<GfMatrix4d> xforms(samples.size());
-
-    for (size_t jointIdx = 0; jointIdx < jointNodes.size(); ++jointIdx) {
+    for (size_t jointIdx = 0; jointIdx < numJointNodes; ++jointIdx) {
 
         if (!jointDep.setObject(jointNodes[jointIdx]))
             continue;
 
-        // Get the transforms of just this joint.
-        for (size_t i = 0; i < samples.size(); ++i) {
-            xforms[i] = samples[i][jointIdx];
-        }
-
-        if (!_SetTransformAnim(jointDep, xforms, mayaTimes, context))
+        if (!_SetTransformAnim(jointDep, jointChannels[jointIdx],
+                               mayaTimes, context))
             return false;
     }
     return true;
@@ -909,46 +960,89 @@ UsdMayaTranslatorSkel::GetBindPose(const UsdSkelSkeletonQuery& skelQuery,
 namespace {
 
 
-bool
-_SetVaryingJointInfluences(const MFnMesh& meshFn,
-                           const MObject& skinCluster,
-                           const VtArray<MObject>& joints,
-                           const VtIntArray& indices,
-                           const VtFloatArray& weights,
-                           int numInfluencesPerPoint,
-                           unsigned int numPoints)
+/// Expand the varying influences of \p weights to the vertex-ordered weights
+/// of all joints expected by a skin cluster.
+void
+_ComputeVertOrderedWeights(
+    const UsdMayaTranslatorSkel::SkinClusterWeights& weights,
+    MDoubleArray* vertOrderedWeights)
 {
-    if (joints.empty())
-        return true;
-
-    MStatus status;
+    const VtIntArray& indices = weights.jointIndices;
+    const VtFloatArray& influenceWeights = weights.jointWeights;
+    const int numInfluencesPerPoint = weights.numInfluencesPerPoint;
+    const unsigned int numPoints = weights.numPoints;
+    const unsigned int numJoints = weights.numJoints;
 
-    MDagPath dagPath;
-    status = meshFn.getPath(dagPath);
-    CHECK_MSTATUS_AND_RETURN(status, false);
-
-    MFnSkinCluster skinClusterFn(skinCluster, &status);
-    CHECK_MSTATUS_AND_RETURN(status, false);
-
-    const unsigned int numJoints = static_cast<unsigned int>(joints.size());
-
-    // Compute a vertex-ordered weight arrays. Weights are stored as:
+    // Weights are stored as:
     //   vert_0_joint_0 ... vert_0_joint_n ... vert_n_joint_0 ... vert_n_joint_n
-    MDoubleArray vertOrderedWeights(numPoints*numJoints, 0.0f); 
+    vertOrderedWeights->setLength(numPoints*numJoints);
+    for (unsigned int i = 0; i < vertOrderedWeights->length(); ++i) {
+        (*vertOrderedWeights)[i] = 0.0;
+    }
     for (unsigned int pt = 0; pt < numPoints; ++pt) {
         for (int c = 0; c < numInfluencesPerPoint; ++c) {
             int jointIdx = indices[pt*numInfluencesPerPoint+c];
             if (jointIdx >= 0 
                && static_cast<unsigned int>(jointIdx) < numJoints) {
-                float w = weights[pt*numInfluencesPerPoint+c];
+                float w = influenceWeights[pt*numInfluencesPerPoint+c];
                 // There may be multiple influences referencing the same joint
                 // for this point. eg., 'unweighted' points are assigned
                 // index 0 and weight 0. Sum the weight contributions to ensure
                 // that we properly account for this.
-                vertOrderedWeights[pt*numJoints + jointIdx] += w;
+                (*vertOrderedWeights)[pt*numJoints + jointIdx] += w;
             }
         }
     }
+}
+
+
+/// Compute the skin cluster weights of \p skinningQuery, for a mesh with
+/// \p numPoints points skinned by \p numJoints joints.
+/// This does not touch any Maya node, so it may run on worker threads.
+bool
+_ComputeSkinClusterWeights(
+    const UsdSkelSkinningQuery& skinningQuery,
+    unsigned int numPoints,
+    unsigned int numJoints,
+    UsdMayaTranslatorSkel::SkinClusterWeights* skinClusterWeights)
+{
+    if (!skinningQuery.ComputeVaryingJointInfluences(
+           numPoints, &skinClusterWeights->jointIndices,
+           &skinClusterWeights->jointWeights)) {
+        return false;
+    }
+
+    skinClusterWeights->numInfluencesPerPoint =
+        skinningQuery.GetNumInfluencesPerComponent();
+    skinClusterWeights->numPoints = numPoints;
+    skinClusterWeights->numJoints = numJoints;
+    return true;
+}
+
+
+bool
+_SetSkinClusterWeights(const MFnMesh& meshFn,
+                       const MObject& skinCluster,
+                       const UsdMayaTranslatorSkel::SkinClusterWeights& weights)
+{
+    if (weights.numJoints == 0)
+        return true;
+
+    MStatus status;
+
+    MDagPath dagPath;
+    status = meshFn.getPath(dagPath);
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    MFnSkinCluster skinClusterFn(skinCluster, &status);
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    const unsigned int numJoints = weights.numJoints;
+
+    // Only expand the weights of the skin cluster being set, to hold the
+    // weights of a single mesh for all of its joints at a time.
+    MDoubleArray vertOrderedWeights;
+    _ComputeVertOrderedWeights(weights, &vertOrderedWeights);
 
     MIntArray influenceIndices(numJoints);
     for (unsigned int i = 0; i < numJoints; ++i) {
@@ -958,7 +1052,7 @@ _SetVaryingJointInfluences(const MFnMesh& meshFn,
     // Set all weights in one batch 
     MFnSingleIndexedComponent components;
     components.create(MFn::kMeshVertComponent);
-    components.setCompleteData(numPoints);
+    components.setCompleteData(weights.numPoints);
 
     // XXX: Note that weights are expected to be pre-normalized in USD.
     // In order to faithfully transfer our source data, we do not perform
@@ -1005,11 +1099,16 @@ _SetVaryingJointInfluences(const MFnMesh& meshFn,
 
 
 bool
-_ComputeAndSetJointInfluences(const UsdSkelSkinningQuery& skinningQuery,
-                              const VtArray<MObject>& joints,
-                              const MObject& skinCluster,
-                              const MObject& shapeToSkin)
+_ComputeAndSetJointInfluences(
+    const UsdSkelSkinningQuery& skinningQuery,
+    const VtArray<MObject>& joints,
+    const MObject& skinCluster,
+    const MObject& shapeToSkin,
+    const UsdMayaTranslatorSkel::SkinClusterWeights* precomputedWeights)
 {
+    if (joints.empty())
+        return true;
+
     MStatus status;
 
     MFnMesh meshFn(shapeToSkin, &status);
@@ -1018,14 +1117,21 @@ _ComputeAndSetJointInfluences(const UsdSkelSkinningQuery& skinningQuery,
     unsigned int numPoints = meshFn.numVertices(&status);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    VtIntArray indices;
-    VtFloatArray weights;
-    if (skinningQuery.ComputeVaryingJointInfluences(
-           numPoints, &indices, &weights)) {
+    const unsigned int numJoints = static_cast<unsigned int>(joints.size());
+
+    // Use the weights computed ahead of time if they match the mesh and
+    // joints, otherwise compute them now.
+    if (precomputedWeights &&
+            precomputedWeights->numPoints == numPoints &&
+            precomputedWeights->numJoints == numJoints &&
+            !precomputedWeights->jointIndices.empty()) {
+        return _SetSkinClusterWeights(meshFn, skinCluster, *precomputedWeights);
+    }
 
-        return _SetVaryingJointInfluences(
-            meshFn, skinCluster, joints, indices, weights,
-            skinningQuery.GetNumInfluencesPerComponent(), numPoints);
+    UsdMayaTranslatorSkel::SkinClusterWeights weights;
+    if (_ComputeSkinClusterWeights(
+           skinningQuery, numPoints, numJoints, &weights)) {
+        return _SetSkinClusterWeights(meshFn, skinCluster, weights);
     }
     return false;
 }
@@ -1125,9 +1231,168 @@ _ConfigureSkinnedObjectTransform(const UsdSkelSkinningQuery& skinningQuery,
 }
 
 
+/// Get the path of the prim holding the influences \p primvar of
+/// \p skinnedPrim. The path of its prototype prim is returned for an
+/// instance proxy, so that all instances of a prim share the same path.
+SdfPath
+_GetInfluencesPathInPrototype(const UsdGeomPrimvar& primvar,
+                              const UsdPrim& skinnedPrim)
+{
+    if (!primvar) {
+        return skinnedPrim.GetPath();
+    }
+    const UsdPrim prim = primvar.GetAttr().GetPrim();
+    if (prim.IsInstanceProxy()) {
+#if USD_VERSION_NUM > 2008
+        return prim.GetPrimInPrototype().GetPath();
+#else
+        return prim.GetPrimInMaster().GetPath();
+#endif
+    }
+    return prim.GetPath();
+}
+
+
+/// Get the number of points of the skinned \p prim, as read by the mesh
+/// reader: at the first time sample within the import interval, or at the
+/// earliest time.
+bool
+_GetNumPoints(const UsdPrim& prim,
+              const UsdMayaPrimReaderArgs& args,
+              unsigned int* numPoints)
+{
+    UsdGeomPointBased pointBased(prim);
+    if (!pointBased)
+        return false;
+
+    const UsdAttribute pointsAttr = pointBased.GetPointsAttr();
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    if (!args.GetTimeInterval().IsEmpty()) {
+        std::vector<double> pointsTimeSamples;
+        pointsAttr.GetTimeSamplesInInterval(args.GetTimeInterval(),
+                                            &pointsTimeSamples);
+        if (!pointsTimeSamples.empty()) {
+            pointsTimeSample = pointsTimeSamples.front();
+        }
+    }
+
+    VtVec3fArray points;
+    if (!pointsAttr.Get(&points, pointsTimeSample))
+        return false;
+
+    *numPoints = static_cast<unsigned int>(points.size());
+    return true;
+}
+
+
 } // namespace
 
 
+/* static */
+void
+UsdMayaTranslatorSkel::ComputeSkinClusterWeights(
+    const UsdSkelCache& skelCache,
+    const std::vector<UsdSkelBinding>& bindings,
+    const UsdMayaPrimReaderArgs& args,
+    std::vector<std::vector<SkinClusterWeights>>* weights)
+{
+    // Skinning targets are identified by the prims holding their joint
+    // influences, which instances of a character share with their
+    // prototype, and by the sizes of the weights.
+    using _Key = std::tuple<SdfPath, SdfPath, unsigned int, unsigned int>;
+
+    struct _Target
+    {
+        const UsdSkelSkinningQuery* skinningQuery;
+        unsigned int numJoints;
+        SkinClusterWeights* weights;
+    };
+
+    weights->clear();
+    weights->resize(bindings.size());
+
+    // Gather the skinning targets of all bindings.
+    std::vector<_Target> targets;
+    for (size_t b = 0; b < bindings.size(); ++b) {
+        const UsdSkelBinding& binding = bindings[b];
+        (*weights)[b].resize(binding.GetSkinningTargets().size());
+
+        const UsdSkelSkeletonQuery skelQuery =
+            skelCache.GetSkelQuery(binding.GetSkeleton());
+        if (!skelQuery)
+            continue;
+
+        for (size_t t = 0; t < binding.GetSkinningTargets().size(); ++t) {
+            const UsdSkelSkinningQuery& skinningQuery =
+                binding.GetSkinningTargets()[t];
+
+            VtTokenArray jointOrder;
+            if (!skinningQuery.GetJointOrder(&jointOrder)) {
+                jointOrder = skelQuery.GetJointOrder();
+            }
+            targets.push_back({ &skinningQuery,
+                                static_cast<unsigned int>(jointOrder.size()),
+                                &(*weights)[b][t] });
+        }
+    }
+
+    // Count the points of each target in parallel, then only compute the
+    // weights of the first target of each key, again in parallel.
+    std::vector<unsigned int> numPoints(targets.size(), 0);
+    WorkParallelForN(
+        targets.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _GetNumPoints(targets[i].skinningQuery->GetPrim(), args,
+                              &numPoints[i]);
+            }
+        });
+
+    std::map<_Key, size_t> uniqueTargets;
+    std::vector<size_t> computedTargets;
+    std::vector<size_t> sharedTargets(targets.size());
+    for (size_t i = 0; i < targets.size(); ++i) {
+        const UsdSkelSkinningQuery& skinningQuery = *targets[i].skinningQuery;
+        const _Key key(
+            _GetInfluencesPathInPrototype(
+                skinningQuery.GetJointIndicesPrimvar(),
+                skinningQuery.GetPrim()),
+            _GetInfluencesPathInPrototype(
+                skinningQuery.GetJointWeightsPrimvar(),
+                skinningQuery.GetPrim()),
+            numPoints[i], targets[i].numJoints);
+
+        auto inserted = uniqueTargets.emplace(key, i);
+        if (inserted.second) {
+            computedTargets.push_back(i);
+        }
+        sharedTargets[i] = inserted.first->second;
+    }
+
+    WorkParallelForN(
+        computedTargets.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const _Target& target = targets[computedTargets[i]];
+                if (numPoints[computedTargets[i]] == 0 ||
+                    target.numJoints == 0) {
+                    continue;
+                }
+                _ComputeSkinClusterWeights(
+                    *target.skinningQuery, numPoints[computedTargets[i]],
+                    target.numJoints, target.weights);
+            }
+        });
+
+    // VtArray shares the weights of instances without copying them.
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (sharedTargets[i] != i) {
+            *targets[i].weights = *targets[sharedTargets[i]].weights;
+        }
+    }
+}
+
+
 /* static */
 bool
 UsdMayaTranslatorSkel::CreateSkinCluster(
@@ -1137,7 +1402,8 @@ UsdMayaTranslatorSkel::CreateSkinCluster(
     const UsdPrim& primToSkin,
     const UsdMayaPrimReaderArgs& args,
     UsdMayaPrimReaderContext* context,
-    const MObject& bindPose)
+    const MObject& bindPose,
+    const SkinClusterWeights* weights)
 {
     MStatus status;
 
@@ -1451,7 +1717,7 @@ UsdMayaTranslatorSkel::CreateSkinCluster(
     }
 
     return _ComputeAndSetJointInfluences(skinningQuery, joints,
-                                         skinCluster, shapeToSkin);
+                                         skinCluster, shapeToSkin, weights);
 }
 
 
@@ -23,10 +23,15 @@
 
 #include <pxr/pxr.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
+
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 class UsdSkelSkeleton;
+class UsdSkelBinding;
+class UsdSkelCache;
 class UsdSkelSkeletonQuery;
 class UsdSkelSkinningQuery;
 
@@ -76,9 +81,38 @@ struct UsdMayaTranslatorSkel
     static MObject GetBindPose(const UsdSkelSkeletonQuery& skelQuery,
                                UsdMayaPrimReaderContext* context);
 
+    /// Joint influences of a skinned prim, as computed by
+    /// UsdSkelSkinningQuery::ComputeVaryingJointInfluences(): the
+    /// \p numInfluencesPerPoint joint indices and weights of each point.
+    /// They are only expanded to the weights of every joint for every point
+    /// expected by a skin cluster while setting its weights.
+    struct SkinClusterWeights
+    {
+        VtIntArray jointIndices;
+        VtFloatArray jointWeights;
+        int numInfluencesPerPoint = 0;
+        unsigned int numPoints = 0;
+        unsigned int numJoints = 0;
+    };
+
+    /// Compute the joint influences of the skinning targets of all
+    /// \p bindings in parallel, ahead of CreateSkinCluster().
+    /// Skinned prims bound to the same joint influences, such as instances
+    /// of the same character, share their weights.
+    /// On return, \p weights holds the weights of each skinning target of
+    /// each binding. Weights which could not be computed are left empty.
+    MAYAUSD_CORE_PUBLIC
+    static void ComputeSkinClusterWeights(
+        const UsdSkelCache& skelCache,
+        const std::vector<UsdSkelBinding>& bindings,
+        const UsdMayaPrimReaderArgs& args,
+        std::vector<std::vector<SkinClusterWeights>>* weights);
+
     /// Create a skin cluster for skinning \p primToSkin.
     /// The skinning cluster is wired up to be driven by the joints
     /// created by CreateJoints().
+    /// If given, \p weights computed by ComputeSkinClusterWeights() are set
+    /// on the skin cluster instead of computing them again.
     /// This currently only supports mesh objects.
     MAYAUSD_CORE_PUBLIC
     static bool CreateSkinCluster(const UsdSkelSkeletonQuery& skelQuery,
@@ -87,7 +121,8 @@ struct UsdMayaTranslatorSkel
                                   const UsdPrim& primToSkin,
                                   const UsdMayaPrimReaderArgs& args,
                                   UsdMayaPrimReaderContext* context,
-                                  const MObject& bindPose=MObject());
+                                  const MObject& bindPose=MObject(),
+                                  const SkinClusterWeights* weights=nullptr);
 };
 
 
@@ -25,12 +25,13 @@
 #include <maya/MFnSet.h>
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <vector>
+
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/diagnostic.h>
 #include <pxr/base/tf/staticTokens.h>
@@ -703,21 +704,17 @@ UsdMayaMeshWriteUtils::writeFaceVertexIndicesData(const MFnMesh& meshFn,
                                                   const UsdTimeCode& usdTime, 
                                                   UsdUtilsSparseValueWriter* valueWriter)
 {
-    const int numFaceVertices = meshFn.numFaceVertices();
-    const int numPolygons = meshFn.numPolygons();
-
-    VtIntArray faceVertexCounts(numPolygons);
-    VtIntArray faceVertexIndices(numFaceVertices);
-    MIntArray mayaFaceVertexIndices; // used in loop below
-    unsigned int curFaceVertexIndex = 0;
-    for (int i = 0; i < numPolygons; i++) {
-        meshFn.getPolygonVertices(i, mayaFaceVertexIndices);
-        faceVertexCounts[i] = mayaFaceVertexIndices.length();
-        for (unsigned int j=0; j < mayaFaceVertexIndices.length(); j++) {
-            faceVertexIndices[ curFaceVertexIndex ] = mayaFaceVertexIndices[j]; // push_back
-            curFaceVertexIndex++;
-        }
+    // Fetch the topology in bulk, it has the same layout in Maya and USD.
+    MIntArray mayaFaceVertexCounts;
+    MIntArray mayaFaceVertexIndices;
+    if (!meshFn.getVertices(mayaFaceVertexCounts, mayaFaceVertexIndices)) {
+        return;
     }
+
+    VtIntArray faceVertexCounts(mayaFaceVertexCounts.length());
+    VtIntArray faceVertexIndices(mayaFaceVertexIndices.length());
+    mayaFaceVertexCounts.get(faceVertexCounts.data());
+    mayaFaceVertexIndices.get(faceVertexIndices.data());
     UsdMayaWriteUtil::SetAttribute(primSchema.GetFaceVertexCountsAttr(), &faceVertexCounts, usdTime, valueWriter);
     UsdMayaWriteUtil::SetAttribute(primSchema.GetFaceVertexIndicesAttr(), &faceVertexIndices, usdTime, valueWriter);
 }
@@ -751,6 +748,9 @@ UsdMayaMeshWriteUtils::getMeshUVSetData(const MFnMesh& mesh,
 
     // Sanity check first to make sure this UV set even has assigned values
     // before we attempt to do anything with the data.
+    // uvCounts holds the number of UVs assigned to each face, which is either
+    // zero or the number of vertices of the face, and uvIds the UV index of
+    // each face vertex with an assigned UV.
     MIntArray uvCounts, uvIds;
     status = mesh.getAssignedUVs(uvCounts, uvIds, &uvSetName);
     if (status != MS::kSuccess) {
@@ -760,9 +760,6 @@ UsdMayaMeshWriteUtils::getMeshUVSetData(const MFnMesh& mesh,
         return false;
     }
 
-    // using itFV.getUV() does not always give us the right answer, so
-    // instead, we have to use itFV.getUVIndex() and use that to index into the
-    // UV set.
     MFloatArray uArray;
     MFloatArray vArray;
     mesh.getUVs(uArray, vArray, &uvSetName);
@@ -770,35 +767,61 @@ UsdMayaMeshWriteUtils::getMeshUVSetData(const MFnMesh& mesh,
         return false;
     }
 
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    status = mesh.getVertices(faceVertexCounts, faceVertexIndices);
+    if (status != MS::kSuccess ||
+            faceVertexCounts.length() != uvCounts.length()) {
+        return false;
+    }
+
     // We'll populate the assignment indices for every face vertex, but we'll
     // only push values into the data if the face vertex has a value. All face
     // vertices are initially unassigned/unauthored.
-    const unsigned int numFaceVertices = mesh.numFaceVertices(&status);
-    uvArray->clear();
+    // Maya UVs are already shared between face vertices, so values are added
+    // once per referenced UV, in the order face vertices first reference
+    // them, rather than once per face vertex.
+    const unsigned int numFaceVertices = faceVertexIndices.length();
+    const unsigned int numUVs = uArray.length();
+    std::vector<int> uvToValueIndex(numUVs, -1);
+    std::vector<GfVec2f> values;
     assignmentIndices->assign((size_t)numFaceVertices, -1);
+    int* const assignmentData = assignmentIndices->data();
     *interpolation = UsdGeomTokens->faceVarying;
 
-    MItMeshFaceVertex itFV(mesh.object());
     unsigned int fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        if (!itFV.hasUVs(uvSetName)) {
-            // No UVs for this faceVertex, so leave it unassigned.
+    unsigned int uvi = 0;
+    for (unsigned int faceIndex = 0; faceIndex < uvCounts.length(); ++faceIndex) {
+        const int faceVertexCount = faceVertexCounts[faceIndex];
+        const int uvCount = uvCounts[faceIndex];
+        if (uvCount != faceVertexCount) {
+            // No UVs for this face, so leave its face vertices unassigned.
+            fvi += faceVertexCount;
+            uvi += uvCount;
             continue;
         }
 
-        int uvIndex;
-        itFV.getUVIndex(uvIndex, &uvSetName);
-        if (uvIndex < 0 || static_cast<size_t>(uvIndex) >= uArray.length()) {
-            return false;
-        }
+        for (int v = 0; v < faceVertexCount; ++v, ++fvi, ++uvi) {
+            const int uvIndex = uvIds[uvi];
+            if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= numUVs) {
+                return false;
+            }
 
-        GfVec2f value(uArray[uvIndex], vArray[uvIndex]);
-        uvArray->push_back(value);
-        (*assignmentIndices)[fvi] = uvArray->size() - 1;
+            int& valueIndex = uvToValueIndex[uvIndex];
+            if (valueIndex < 0) {
+                valueIndex = static_cast<int>(values.size());
+                values.emplace_back(uArray[uvIndex], vArray[uvIndex]);
+            }
+            assignmentData[fvi] = valueIndex;
+        }
     }
 
+    uvArray->assign(values.begin(), values.end());
+
     UsdMayaUtil::MergeEquivalentIndexedValues(uvArray, assignmentIndices);
-    UsdMayaUtil::CompressFaceVaryingPrimvarIndices(mesh, interpolation, assignmentIndices);
+    UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
+        faceVertexCounts, faceVertexIndices, mesh.numVertices(),
+        interpolation, assignmentIndices);
 
     return true;
 }
@@ -1125,6 +1148,15 @@ UsdMayaMeshWriteUtils::getMeshColorSetData(MFnMesh& mesh,
         return false;
     }
 
+    // The face vertex colors follow the face vertex order of the mesh
+    // topology, which gives us the face of each face vertex.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!mesh.getVertices(faceVertexCounts, faceVertexIndices) ||
+            faceVertexIndices.length() != colorSetData.length()) {
+        return false;
+    }
+
     // Get the color set representation and clamping.
     *colorSetRep = mesh.getColorRepresentation(colorSet);
     *clamped = mesh.isColorClamped(colorSet);
@@ -1138,9 +1170,15 @@ UsdMayaMeshWriteUtils::getMeshColorSetData(MFnMesh& mesh,
     *interpolation = UsdGeomTokens->faceVarying;
 
     // Loop over every face vertex to populate the value arrays.
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
+    const unsigned int numFaceVertices = colorSetData.length();
+    const unsigned int numFaces = faceVertexCounts.length();
+    int faceIndex = -1;
+    unsigned int faceEnd = 0;
+    for (unsigned int fvi = 0; fvi < numFaceVertices; ++fvi) {
+        while (fvi == faceEnd && faceIndex + 1 < static_cast<int>(numFaces)) {
+            faceEnd += faceVertexCounts[++faceIndex];
+        }
+
         // If this is a displayColor color set, we may need to fallback on the
         // bound shader colors/alphas for this face in some cases. In
         // particular, if the color set is alpha-only, we fallback on the
@@ -1169,7 +1207,6 @@ UsdMayaMeshWriteUtils::getMeshColorSetData(MFnMesh& mesh,
 
         // Shader values for the mesh could be constant
         // (shadersAssignmentIndices is empty) or uniform.
-        int faceIndex = itFV.faceId();
         if (useShaderColorFallback) {
             // There was no color value in the color set to use, so we use the
             // shader color, or the default color if there is no shader color.
@@ -1251,7 +1288,9 @@ UsdMayaMeshWriteUtils::getMeshColorSetData(MFnMesh& mesh,
                                   colorSetAlphaData,
                                   colorSetAssignmentIndices);
 
-    UsdMayaUtil::CompressFaceVaryingPrimvarIndices(mesh,
+    UsdMayaUtil::CompressFaceVaryingPrimvarIndices(faceVertexCounts,
+                                                   faceVertexIndices,
+                                                   mesh.numVertices(),
                                                    interpolation,
                                                    colorSetAssignmentIndices);
 
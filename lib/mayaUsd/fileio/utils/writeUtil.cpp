@@ -46,8 +46,10 @@
 #include <pxr/pxr.h>
 #include <pxr/base/gf/gamma.h>
 #include <pxr/base/gf/rotation.h>
+#include <pxr/base/gf/vec3d.h>
 #include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/base/vt/types.h>
 #include <pxr/base/vt/value.h>
 #include <pxr/usd/sdf/path.h>
@@ -924,16 +926,39 @@ UsdMayaWriteUtil::WriteClassInherits(
     return true;
 }
 
-template <typename MArrayType, typename M, typename V>
+static void
+_GetMayaArrayData(const MDoubleArray& mayaArray, std::vector<double>* values)
+{
+    values->resize(mayaArray.length());
+    mayaArray.get(values->data());
+}
+
+static void
+_GetMayaArrayData(const MVectorArray& mayaArray, std::vector<GfVec3d>* values)
+{
+    values->resize(mayaArray.length());
+    mayaArray.get(reinterpret_cast<double (*)[3]>(values->data()));
+}
+
+/// Converts the elements of \p mayaArray with \p mapper. The Maya array is
+/// copied in bulk first, and the elements are then converted in parallel, as
+/// instancers commonly carry millions of instances.
+template <typename M, typename V, typename MArrayType, typename Mapper>
 static VtArray<V>
 _MapMayaToVtArray(
     const MArrayType& mayaArray,
-    const std::function<V (const M)> mapper)
+    const Mapper& mapper)
 {
-    VtArray<V> vtArray(mayaArray.length());
-    for (unsigned int i = 0; i < mayaArray.length(); ++i) {
-        vtArray[i] = mapper(mayaArray[i]);
-    }
+    std::vector<M> values;
+    _GetMayaArrayData(mayaArray, &values);
+
+    VtArray<V> vtArray(values.size());
+    V* vtData = vtArray.data();
+    WorkParallelForN(values.size(), [&values, &mapper, vtData](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            vtData[i] = mapper(values[i]);
+        }
+    });
     return vtArray;
 }
 
@@ -992,8 +1017,7 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
         const MDoubleArray id = inputPointsData.doubleArray("id", &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        indicesOrIds = _MapMayaToVtArray<
-            MDoubleArray, double, int64_t>(
+        indicesOrIds = _MapMayaToVtArray<double, int64_t>(
             id,
             [](double x) {
                 return (int64_t) x;
@@ -1016,7 +1040,7 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
                 "objectIndex", &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        VtIntArray vtArray = _MapMayaToVtArray<MDoubleArray, double, int>(
+        VtIntArray vtArray = _MapMayaToVtArray<double, int>(
             objectIndex,
             [numPrototypes](double x) {
                 if (x < numPrototypes) {
@@ -1042,11 +1066,10 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
                 &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        VtVec3fArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfVec3f>(
+        VtVec3fArray vtArray = _MapMayaToVtArray<GfVec3d, GfVec3f>(
             position,
-            [](const MVector& v) {
-                return GfVec3f(v.x, v.y, v.z);
+            [](const GfVec3d& v) {
+                return GfVec3f(v);
             });
         SetAttribute(instancer.CreatePositionsAttr(), vtArray, usdTime, valueWriter);
     }
@@ -1062,13 +1085,12 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
                 &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        VtQuathArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfQuath>(
+        VtQuathArray vtArray = _MapMayaToVtArray<GfVec3d, GfQuath>(
             rotation,
-            [](const MVector& v) {
-                GfRotation rot = GfRotation(GfVec3d::XAxis(), v.x)
-                        * GfRotation(GfVec3d::YAxis(), v.y)
-                        * GfRotation(GfVec3d::ZAxis(), v.z);
+            [](const GfVec3d& v) {
+                GfRotation rot = GfRotation(GfVec3d::XAxis(), v[0])
+                        * GfRotation(GfVec3d::YAxis(), v[1])
+                        * GfRotation(GfVec3d::ZAxis(), v[2]);
                 return GfQuath(rot.GetQuat());
             });
         SetAttribute(instancer.CreateOrientationsAttr(), vtArray, usdTime, valueWriter);
@@ -1085,11 +1107,10 @@ UsdMayaWriteUtil::WriteArrayAttrsToInstancer(
                 &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        VtVec3fArray vtArray = _MapMayaToVtArray<
-            MVectorArray, const MVector&, GfVec3f>(
+        VtVec3fArray vtArray = _MapMayaToVtArray<GfVec3d, GfVec3f>(
             scale,
-            [](const MVector& v) {
-                return GfVec3f(v.x, v.y, v.z);
+            [](const GfVec3d& v) {
+                return GfVec3f(v);
             });
         SetAttribute(instancer.CreateScalesAttr(), vtArray, usdTime, valueWriter);
     }
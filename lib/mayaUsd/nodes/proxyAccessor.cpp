@@ -196,8 +196,10 @@ MAYAUSD_NS_DEF
 
         _accessorInputItems.clear();
         _accessorOutputItems.clear();
+        _accessorInputIndices.clear();
 
         _validAccessorItems = true;
+        _validResolvedItems = false;
 
         auto stage = getUsdStage();
         if (!stage)
@@ -270,16 +272,74 @@ MAYAUSD_NS_DEF
 
             if (isAccessorValueInputPlug(valuePlug)) {
                 TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Added INPUT '%s'\n", path.GetText());
-                _accessorInputItems.emplace_back(valuePlug, path, converter);
+                _accessorInputIndices.emplace(path, _accessorInputItems.size());
+                _accessorInputItems.emplace_back(
+                    valuePlug, path, converter, UsdPrim(), UsdAttribute());
             } else {
                 TF_DEBUG(USDMAYA_PROXYACCESSOR).Msg("Added OUTPUT '%s'\n", path.GetText());
-                _accessorOutputItems.emplace_back(valuePlug, path, converter);
+                _accessorOutputItems.emplace_back(
+                    valuePlug, path, converter, UsdPrim(), UsdAttribute());
             }
         }
 
         return;
     }
 
+    void ProxyAccessor::resolveAccessorItems(const UsdStageRefPtr& stage)
+    {
+        if (_validResolvedItems && _resolvedStage == UsdStageWeakPtr(stage))
+            return;
+
+        MProfilingScope profilingScope(
+            _accessorProfilerCategory, MProfiler::kColorB_L1, "Resolve accessor items");
+
+        auto resolveItemFn = [&stage](Item& item) {
+            const SdfPath& itemPath = std::get<1>(item);
+
+            UsdPrim      itemPrim = stage->GetPrimAtPath(itemPath.GetPrimPath());
+            UsdAttribute itemAttribute;
+            if (itemPrim && itemPath.IsPrimPropertyPath()) {
+                itemAttribute = itemPrim.GetAttribute(itemPath.GetNameToken());
+                if (!itemAttribute.IsDefined())
+                    itemAttribute = UsdAttribute();
+            }
+
+            std::get<3>(item) = itemPrim;
+            std::get<4>(item) = itemAttribute;
+        };
+
+        for (auto& item : _accessorInputItems) {
+            resolveItemFn(item);
+        }
+        for (auto& item : _accessorOutputItems) {
+            resolveItemFn(item);
+        }
+
+        _resolvedStage = stage;
+        _validResolvedItems = true;
+    }
+
+    bool ProxyAccessor::isOutputAffected(const SdfPath& outputPath) const
+    {
+        const SdfPath outputPrimPath = outputPath.GetPrimPath();
+        const bool    isWorldMatrixOutput = !outputPath.IsPrimPropertyPath();
+
+        for (const SdfPath& changedPath : _changedPaths) {
+            if (changedPath.IsPrimPropertyPath()) {
+                // A property change affects outputs reading this property. World matrix outputs
+                // are affected by any property change on the prim or its ancestors.
+                if (changedPath == outputPath)
+                    return true;
+                if (isWorldMatrixOutput && outputPrimPath.HasPrefix(changedPath.GetPrimPath()))
+                    return true;
+            } else if (outputPrimPath.HasPrefix(changedPath)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     MStatus ProxyAccessor::addDependentsDirty(const MPlug& plug, MPlugArray& plugArray)
     {
         if (inCompute())
@@ -296,11 +356,21 @@ MAYAUSD_NS_DEF
         const bool accessorValuePlug = isAccessorValuePlugName(plug.partialName().asChar());
         const bool isInputValuePlug = accessorValuePlug && isAccessorValueInputPlug(plug);
 
-        if (isInputValuePlug || !plug.isDynamic() || plug == _forceCompute) {
+        const bool isForceComputePlug = (plug == _forceCompute);
+        if (isInputValuePlug || !plug.isDynamic() || isForceComputePlug) {
+            // Changes received from USD only dirty the outputs they affect
+            const bool dirtyAffectedOnly = isForceComputePlug && !_changedPaths.empty();
+
             TF_DEBUG(USDMAYA_PROXYACCESSOR)
-                .Msg("Dirty all outputs from '%s'\n", plug.name().asChar());
+                .Msg(
+                    "Dirty %s outputs from '%s'\n",
+                    dirtyAffectedOnly ? "affected" : "all",
+                    plug.name().asChar());
 
             for (const auto& item : _accessorOutputItems) {
+                if (dirtyAffectedOnly && !isOutputAffected(std::get<1>(item)))
+                    continue;
+
                 const MPlug& itemPlug = std::get<0>(item);
                 if (!itemPlug.isArray())
                     plugArray.append(itemPlug);
@@ -311,6 +381,9 @@ MAYAUSD_NS_DEF
                     }
                 }
             }
+
+            if (isForceComputePlug)
+                _changedPaths.clear();
         }
         return MS::kSuccess;
     }
@@ -328,6 +401,9 @@ MAYAUSD_NS_DEF
 
         Scoped_InCompute inComputeNow(*this);
 
+        // Outputs affected by changes to USD were dirtied already
+        _changedPaths.clear();
+
         collectAccessorItems(plug.node());
 
         // Early exit to avoid virtual function calls when no compute will happen
@@ -344,6 +420,8 @@ MAYAUSD_NS_DEF
         // Compute dependencies is considered as temporary data
         UsdEditContext editContext(stage, stage->GetSessionLayer());
 
+        resolveAccessorItems(stage);
+
         computeInputs(stage, dataBlock, args);
         computeOutputs(plug.node(), stage, dataBlock, args);
 
@@ -358,8 +436,7 @@ MAYAUSD_NS_DEF
             const MPlug&     itemPlug = std::get<0>(item);
             const SdfPath&   itemPath = std::get<1>(item);
             const Converter* itemConverter = std::get<2>(item);
-            // We should cache UsdAttribute in here too and avoid expensive
-            // searches (i.e. getting the prim, getting attribute, checking if defined)
+            UsdAttribute     itemAttribute = std::get<4>(item);
 
             MProfilingScope profilingScope(
                 _accessorProfilerCategory,
@@ -367,16 +444,10 @@ MAYAUSD_NS_DEF
                 "Write input",
                 itemPath.GetText());
 
-            SdfPath        itemPrimPath = itemPath.GetPrimPath();
-            const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPrimPath);
-
             if (!itemPath.IsPrimPropertyPath() || !itemConverter)
                 continue;
 
-            const TfToken& itemPropertyToken = itemPath.GetNameToken();
-            UsdAttribute   itemAttribute = itemPrim.GetAttribute(itemPropertyToken);
-
-            if (!itemAttribute.IsDefined()) {
+            if (!itemAttribute) {
                 TF_CODING_ERROR("Undefined/invalid attribute '%s'", itemPath.GetText());
                 continue;
             }
@@ -419,8 +490,11 @@ MAYAUSD_NS_DEF
             const MPlug&     itemPlug = std::get<0>(item);
             const SdfPath&   itemPath = std::get<1>(item);
             const Converter* itemConverter = std::get<2>(item);
-            // We should cache UsdAttribute in here too and avoid expensive
-            // searches (i.e. getting the prim, getting attribute, checking if defined)
+            const UsdPrim&   itemPrim = std::get<3>(item);
+
+            // Outputs which were not affected by the last changes are still clean
+            if (dataBlock.isClean(itemPlug))
+                continue;
 
             MProfilingScope profilingScope(
                 _accessorProfilerCategory,
@@ -428,9 +502,6 @@ MAYAUSD_NS_DEF
                 "Write output",
                 itemPath.GetText());
 
-            SdfPath        itemPrimPath = itemPath.GetPrimPath();
-            const UsdPrim& itemPrim = stage->GetPrimAtPath(itemPrimPath);
-
             MDataHandle itemDataHandle = dataBlock.outputValue(itemPlug, &retValue);
             if (MFAIL(retValue)) {
                 continue;
@@ -457,11 +528,9 @@ MAYAUSD_NS_DEF
                 dstArray.set(dstArrayBuilder);
                 dstArray.setAllClean();
             } else if (itemConverter) {
-                const TfToken& itemPropertyToken = itemPath.GetNameToken();
-                UsdAttribute   itemAttribute = itemPrim.GetAttribute(itemPropertyToken);
+                const UsdAttribute& itemAttribute = std::get<4>(item);
 
-                // cache this! expensive call
-                if (!itemAttribute.IsDefined()) {
+                if (!itemAttribute) {
                     TF_CODING_ERROR("Undefined/invalid attribute '%s'", itemPath.GetText());
 
                     dataBlock.setClean(itemPlug);
@@ -510,6 +579,8 @@ MAYAUSD_NS_DEF
         // Compute dependencies is considered as temporary data
         UsdEditContext editContext(stage, stage->GetSessionLayer());
 
+        resolveAccessorItems(stage);
+
         return computeInputs(stage, dataBlock, args);
     }
 
@@ -523,18 +594,21 @@ MAYAUSD_NS_DEF
             return MS::kUnknownParameter;
         }
 
+        // Resolved prims and attributes may have expired
+        if (!notice.GetResyncedPaths().empty())
+            _validResolvedItems = false;
+
         bool needsForceCompute = true;
 
         if (_accessorInputItems.size() > 0) {
             auto findInputItemFn = [this](const SdfPath& changedPath) -> Item* {
-                for (auto& item : _accessorInputItems) {
-                    if (std::get<1>(item) == changedPath) {
-                        return &item;
-                    }
-                }
-                return nullptr;
+                auto it = _accessorInputIndices.find(changedPath);
+                return it != _accessorInputIndices.end() ? &_accessorInputItems[it->second]
+                                                         : nullptr;
             };
 
+            resolveAccessorItems(getUsdStage());
+
             // UFE currently doesn't write time sampled data.
             ConverterArgs args;
             args._timeCode = UsdTimeCode::Default(); // getTime();
@@ -556,14 +630,12 @@ MAYAUSD_NS_DEF
                     TF_DEBUG(USDMAYA_PROXYACCESSOR)
                         .Msg("Input PrimPropertyPath has changed '%s'\n", changedPath.GetText());
 
-                    MPlug&           changedPlug = std::get<0>(*changedInput);
-                    const Converter* converter = std::get<2>(*changedInput);
-
-                    SdfPath        changedPrimPath = changedPath.GetPrimPath();
-                    const UsdPrim& changedPrim = stage->GetPrimAtPath(changedPrimPath);
+                    MPlug&              changedPlug = std::get<0>(*changedInput);
+                    const Converter*    converter = std::get<2>(*changedInput);
+                    const UsdAttribute& changedAttribute = std::get<4>(*changedInput);
 
-                    const TfToken& changedPropertyToken = changedPath.GetNameToken();
-                    UsdAttribute changedAttribute = changedPrim.GetAttribute(changedPropertyToken);
+                    if (!changedAttribute)
+                        continue;
 
                     converter->convert(changedAttribute, changedPlug, args);
 
@@ -577,6 +649,13 @@ MAYAUSD_NS_DEF
         }
 
         if (needsForceCompute && _accessorOutputItems.size() > 0) {
+            for (const auto& resyncedPath : notice.GetResyncedPaths()) {
+                _changedPaths.push_back(resyncedPath);
+            }
+            for (const auto& changedPath : notice.GetChangedInfoOnlyPaths()) {
+                _changedPaths.push_back(changedPath);
+            }
+
             forceCompute(node);
         }
 
@@ -19,6 +19,9 @@
 #include "../base/api.h"
 #include "proxyStageProvider.h"
 #include "pxr/pxr.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/stage.h"
 #include "pxr/usd/usd/timeCode.h"
 
@@ -38,6 +41,8 @@
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
@@ -164,10 +169,13 @@ MAYAUSD_NS_DEF
     private:
         /*! \brief  Single item in acceleration structure holding.
             To avoid expensive searches during compute, we cache MPlug, SdfPath and converter needed
-           to translate values between data models.
+           to translate values between data models. The prim and attribute at SdfPath are resolved
+           once and kept until the stage gets resynced.
          */
-        using Item = std::tuple<MPlug, SdfPath, const Converter*>;
+        using Item = std::tuple<MPlug, SdfPath, const Converter*, UsdPrim, UsdAttribute>;
         using Container = std::vector<Item>;
+        //! \brief  Index of items in acceleration structure, by SdfPath
+        using ItemIndexMap = std::unordered_map<SdfPath, size_t, SdfPath::Hash>;
 
         ProxyAccessor(ProxyStageProvider& provider)
             : _stageProvider(provider)
@@ -191,6 +199,10 @@ MAYAUSD_NS_DEF
         void collectAccessorItems(MObject node);
         //! \brief  Invalidate acceleration structure
         void invalidateAccessorItems() { _validAccessorItems = false; }
+        //! \brief  Resolve prims and attributes of accessor items, if not resolved already
+        void resolveAccessorItems(const UsdStageRefPtr& stage);
+        //! \brief  Is the output item at given path affected by stage changes received since last compute
+        bool isOutputAffected(const SdfPath& outputPath) const;
 
         //! \brief  Notification from MPxNode to insert accessor plugs dependencies
         MStatus addDependentsDirty(const MPlug& plug, MPlugArray& plugArray);
@@ -232,8 +244,17 @@ MAYAUSD_NS_DEF
         Container _accessorInputItems;
         //! \brief  Acceleration structure holding all output accessor plugs
         Container _accessorOutputItems;
+        //! \brief  Index of input accessor items, used to find inputs changed in USD
+        ItemIndexMap _accessorInputIndices;
         //! \brief  Flag to indicate if acceleration structure is valid or needs to be recreated
         bool _validAccessorItems { false };
+        //! \brief  Flag to indicate if prims and attributes of accessor items need to be resolved
+        bool _validResolvedItems { false };
+        //! \brief  Stage for which prims and attributes of accessor items were resolved
+        UsdStageWeakPtr _resolvedStage;
+        //! \brief  Paths changed in USD since the last forced compute, used to only dirty affected
+        //! outputs
+        SdfPathVector _changedPaths;
         bool _inCompute { false }; //!< Prevent nested compute
 
         //! \brief  Helper scoped object to prevent nested compute
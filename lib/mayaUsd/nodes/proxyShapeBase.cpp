@@ -15,8 +15,13 @@
 //
 #include "proxyShapeBase.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -49,9 +54,12 @@
 #include <maya/MStatus.h>
 #include <maya/MString.h>
 #include <maya/MTime.h>
+#include <maya/MUuid.h>
 #include <maya/MViewport2Renderer.h>
 #include <maya/MEvaluationNode.h>
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/arch/hash.h>
 #include <pxr/base/gf/bbox3d.h>
 #include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/ray.h>
@@ -65,6 +73,7 @@
 #include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/trace/trace.h>
+#include <pxr/base/work/detachedTask.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
@@ -82,6 +91,7 @@
 #include <mayaUsd/nodes/stageData.h>
 #include <mayaUsd/utils/query.h>
 #include <mayaUsd/utils/stageCache.h>
+#include <mayaUsd/utils/stageWarmUp.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
 #include <boost/filesystem.hpp>
@@ -102,6 +112,199 @@ MayaUsdProxyShapeBase::_sharedClosestPointDelegate = nullptr;
 
 const std::string kAnonymousLayerName{"anonymousLayer1"};
 
+TF_DEFINE_ENV_SETTING(MAYAUSD_ASYNC_STAGE_OPEN, false,
+    "Open the USD stages of proxy shapes on worker threads. A proxy shape "
+    "has no stage until its stage is opened, then it gets dirtied to pick "
+    "it up.");
+
+TF_DEFINE_ENV_SETTING(MAYAUSD_PERSIST_BOUNDING_BOXES, true,
+    "Save the bounding boxes of proxy shapes with the scene, so that they "
+    "are available before the stages get composed when the scene is opened.");
+
+namespace {
+
+// Maximum number of time samples of the bounding box saved with the scene
+constexpr size_t kMaxPersistedBoundingBoxes = 256;
+
+unsigned int
+_GetPurposeMask(bool drawRenderPurpose, bool drawProxyPurpose, bool drawGuidePurpose)
+{
+    return (drawRenderPurpose ? 1u : 0u) |
+           (drawProxyPurpose ? 2u : 0u) |
+           (drawGuidePurpose ? 4u : 0u);
+}
+
+// Hash of the content of a session layer, 0 for no or an empty session layer.
+uint64_t
+_GetSessionLayerHash(const SdfLayerHandle& sessionLayer)
+{
+    std::string content;
+    if (!sessionLayer || sessionLayer->IsEmpty() ||
+        !sessionLayer->ExportToString(&content)) {
+        return 0;
+    }
+    return ArchHash64(content.c_str(), content.size());
+}
+
+// Guards the opening of stages in the stage cache. The stage cache bound by
+// UsdStageCacheContext is process-wide rather than per thread, so only one
+// thread at a time may open stages with it. Stages opened on worker threads
+// are opened without it, and inserted in the stage cache under this lock.
+std::mutex _stageCacheMutex;
+
+// Opens the stage without looking for it nor inserting it in the stage cache.
+UsdStageRefPtr
+_OpenUncachedStage(
+    const std::string& filePath,
+    const SdfLayerRefPtr& sessionLayer,
+    const ArResolverContext& resolverContext,
+    UsdStage::InitialLoadSet loadSet)
+{
+    UsdStageRefPtr usdStage;
+
+    if (SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(filePath)) {
+        if (sessionLayer) {
+            usdStage = UsdStage::Open(rootLayer,
+                    sessionLayer,
+                    resolverContext,
+                    loadSet);
+        } else {
+            usdStage = UsdStage::Open(rootLayer,
+                    resolverContext,
+                    loadSet);
+        }
+
+        usdStage->SetEditTarget(usdStage->GetRootLayer());
+    }
+    else {
+        // Create a new stage in memory with an anonymous root layer.
+        usdStage = UsdStage::CreateInMemory(kAnonymousLayerName, loadSet);
+    }
+
+    return usdStage;
+}
+
+UsdStageRefPtr
+_OpenStage(
+    const std::string& filePath,
+    const SdfLayerRefPtr& sessionLayer,
+    const ArResolverContext& resolverContext,
+    UsdStage::InitialLoadSet loadSet)
+{
+    std::lock_guard<std::mutex> lock(_stageCacheMutex);
+
+    // When opening or creating stages we must have an active UsdStageCache.
+    // The stage cache is the only one who holds a strong reference to the
+    // UsdStage. See https://github.com/Autodesk/maya-usd/issues/528 for
+    // more information.
+    UsdStageCacheContext ctx(UsdMayaStageCache::Get(loadSet == UsdStage::InitialLoadSet::LoadAll));
+
+    return _OpenUncachedStage(filePath, sessionLayer, resolverContext, loadSet);
+}
+
+// Returns the stage _OpenStage() would return if it is already opened.
+UsdStageRefPtr
+_FindCachedStage(
+    const std::string& filePath,
+    const SdfLayerRefPtr& sessionLayer,
+    const ArResolverContext& resolverContext,
+    UsdStage::InitialLoadSet loadSet)
+{
+    SdfLayerRefPtr rootLayer = SdfLayer::Find(filePath);
+    if (!rootLayer) {
+        return UsdStageRefPtr();
+    }
+
+    UsdStageCache& stageCache =
+        UsdMayaStageCache::Get(loadSet == UsdStage::InitialLoadSet::LoadAll);
+    return sessionLayer ?
+        stageCache.FindOneMatching(rootLayer, sessionLayer, resolverContext) :
+        stageCache.FindOneMatching(rootLayer, resolverContext);
+}
+
+#if MAYA_API_VERSION >= 20190000
+// Progress of a warm-up running on a worker thread
+struct _WarmUpProgress
+{
+    UsdStageRefPtr  stage;
+    size_t          processedPrimCount;
+    size_t          primCount;
+};
+
+void
+_SendWarmUpNotice(void* data)
+{
+    std::unique_ptr<_WarmUpProgress> progress(static_cast<_WarmUpProgress*>(data));
+    UsdMayaStageWarmUpNotice(
+        progress->stage, progress->processedPrimCount, progress->primCount).Send();
+}
+#endif
+
+// Sends the progress notice of a warm-up running on a worker thread from the
+// main thread, where notice listeners expect to be called. Notices aren't sent
+// with Maya versions that can't run tasks on idle.
+void
+_PostWarmUpNotice(
+    const UsdStageRefPtr& usdStage,
+    size_t processedPrimCount,
+    size_t primCount)
+{
+#if MAYA_API_VERSION >= 20190000
+    MGlobal::executeTaskOnIdle(_SendWarmUpNotice,
+        new _WarmUpProgress{ usdStage, processedPrimCount, primCount });
+#endif
+}
+
+// Inserts a stage opened by _OpenUncachedStage() in the stage cache. If a
+// matching stage got opened in the meantime, that stage is returned instead.
+UsdStageRefPtr
+_InsertCachedStage(
+    const UsdStageRefPtr& usdStage,
+    const std::string& filePath,
+    const SdfLayerRefPtr& sessionLayer,
+    const ArResolverContext& resolverContext,
+    UsdStage::InitialLoadSet loadSet)
+{
+    std::lock_guard<std::mutex> lock(_stageCacheMutex);
+
+    if (UsdStageRefPtr cachedStage =
+            _FindCachedStage(filePath, sessionLayer, resolverContext, loadSet)) {
+        return cachedStage;
+    }
+
+    UsdMayaStageCache::Get(loadSet == UsdStage::InitialLoadSet::LoadAll).Insert(usdStage);
+    return usdStage;
+}
+
+} // anonymous namespace
+
+// A stage opened on a worker thread. Proxy shapes requesting the same stage
+// share the request, so the stage is opened once.
+struct MayaUsdProxyShapeBase::_AsyncStageOpen
+{
+    using Key = std::tuple<std::string, UsdStage::InitialLoadSet, SdfLayerHandle>;
+
+    Key                         key;
+    UsdStageRefPtr              stage;
+    std::atomic<bool>           done{ false };
+
+    // Guards stage, warmUp and the proxy shapes to notify once done
+    std::mutex                  mutex;
+    std::vector<std::string>    nodeUuids;
+
+    // Warm-up of the opened stage, cancelled when a query needs the stage
+    std::shared_ptr<UsdMayaStageWarmUp> warmUp;
+
+    // Pending requests indexed by key
+    static std::mutex                                   registryMutex;
+    static std::map<Key, std::weak_ptr<_AsyncStageOpen>> registry;
+};
+
+std::mutex MayaUsdProxyShapeBase::_AsyncStageOpen::registryMutex;
+std::map<MayaUsdProxyShapeBase::_AsyncStageOpen::Key,
+    std::weak_ptr<MayaUsdProxyShapeBase::_AsyncStageOpen>>
+    MayaUsdProxyShapeBase::_AsyncStageOpen::registry;
+
 // ========================================================
 
 // TypeID from the MayaUsd type ID range.
@@ -126,6 +329,7 @@ MObject MayaUsdProxyShapeBase::inStageDataCachedAttr;
 MObject MayaUsdProxyShapeBase::drawRenderPurposeAttr;
 MObject MayaUsdProxyShapeBase::drawProxyPurposeAttr;
 MObject MayaUsdProxyShapeBase::drawGuidePurposeAttr;
+MObject MayaUsdProxyShapeBase::persistedBoundingBoxesAttr;
 // Output attributes
 MObject MayaUsdProxyShapeBase::outTimeAttr;
 MObject MayaUsdProxyShapeBase::outStageDataAttr;
@@ -293,6 +497,21 @@ MayaUsdProxyShapeBase::initialize()
     retValue = addAttribute(drawGuidePurposeAttr);
     CHECK_MSTATUS_AND_RETURN_IT(retValue);
 
+    // Bounding boxes computed for the stage, saved with the scene along with
+    // the modification times of the layers they were computed from.
+    persistedBoundingBoxesAttr = typedAttrFn.create(
+        "persistedBoundingBoxes",
+        "pbbx",
+        MFnData::kString,
+        MObject::kNullObj,
+        &retValue);
+    typedAttrFn.setInternal(true);
+    typedAttrFn.setHidden(true);
+    typedAttrFn.setConnectable(false);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+    retValue = addAttribute(persistedBoundingBoxesAttr);
+    CHECK_MSTATUS_AND_RETURN_IT(retValue);
+
     // outputs
     outTimeAttr = unitAttrFn.create(
         "outTime",
@@ -401,6 +620,40 @@ MayaUsdProxyShapeBase::enableProxyAccessor()
     _usdAccessor = ProxyAccessor::createAndRegister(*this);
 }
 
+/* virtual */
+bool
+MayaUsdProxyShapeBase::getInternalValueInContext(
+        const MPlug& plug,
+        MDataHandle& dataHandle,
+        MDGContext& ctx)
+{
+    if (plug == persistedBoundingBoxesAttr) {
+        // Save the bounding boxes read with the scene as is if the stage
+        // hasn't been composed since.
+        const std::string data = _boundingBoxCache.empty() ?
+            _persistedBoundingBoxes.data : _SerializeBoundingBoxCache();
+        dataHandle.set(MString(data.c_str()));
+        return true;
+    }
+
+    return MPxSurfaceShape::getInternalValueInContext(plug, dataHandle, ctx);
+}
+
+/* virtual */
+bool
+MayaUsdProxyShapeBase::setInternalValueInContext(
+        const MPlug& plug,
+        const MDataHandle& dataHandle,
+        MDGContext& ctx)
+{
+    if (plug == persistedBoundingBoxesAttr) {
+        _ParsePersistedBoundingBoxes(dataHandle.asString().asChar());
+        return true;
+    }
+
+    return MPxSurfaceShape::setInternalValueInContext(plug, dataHandle, ctx);
+}
+
 /* virtual */
 void
 MayaUsdProxyShapeBase::postConstructor()
@@ -563,31 +816,22 @@ MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
             loadSet = UsdStage::InitialLoadSet::LoadNone;
         }
 
-        {
-            // When opening or creating stages we must have an active UsdStageCache.
-            // The stage cache is the only one who holds a strong reference to the
-            // UsdStage. See https://github.com/Autodesk/maya-usd/issues/528 for
-            // more information.
-            UsdStageCacheContext ctx(UsdMayaStageCache::Get(loadSet == UsdStage::InitialLoadSet::LoadAll));
-            
-            if (SdfLayerRefPtr rootLayer = SdfLayer::FindOrOpen(fileString)) {
-                SdfLayerRefPtr sessionLayer = computeSessionLayer(dataBlock);
-                if (sessionLayer) {
-                    usdStage = UsdStage::Open(rootLayer,
-                            sessionLayer,
-                            ArGetResolver().GetCurrentContext(),
-                            loadSet);
-                } else {
-                    usdStage = UsdStage::Open(rootLayer,
-                            ArGetResolver().GetCurrentContext(),
-                            loadSet);
-                }
+        SdfLayerRefPtr sessionLayer = computeSessionLayer(dataBlock);
+        const ArResolverContext resolverContext = ArGetResolver().GetCurrentContext();
 
-                usdStage->SetEditTarget(usdStage->GetRootLayer());
-            }
-            else {
-                // Create a new stage in memory with an anonymous root layer.
-                usdStage = UsdStage::CreateInMemory(kAnonymousLayerName, loadSet);
+        if (TfGetEnvSetting(MAYAUSD_ASYNC_STAGE_OPEN)) {
+            usdStage = _GetAsyncStage(fileString, sessionLayer, resolverContext, loadSet);
+        }
+        else {
+            // Only warm up the stages opened here. The main thread is busy
+            // with the warm-up, so nothing edits the stage in the meantime.
+            const bool warmUp = UsdMayaStageWarmUp::IsEnabled() &&
+                !_FindCachedStage(fileString, sessionLayer, resolverContext, loadSet);
+
+            usdStage = _OpenStage(fileString, sessionLayer, resolverContext, loadSet);
+
+            if (warmUp && usdStage) {
+                UsdMayaStageWarmUp(usdStage).Run();
             }
         }
 
@@ -622,6 +866,126 @@ MayaUsdProxyShapeBase::computeInStageDataCached(MDataBlock& dataBlock)
     }
 }
 
+// Returns the stage opened for the given file, or null while it is being
+// opened on a worker thread. The proxy shape gets dirtied once the stage is
+// opened, so that next compute picks it up. Stages already in the stage cache
+// are returned right away.
+UsdStageRefPtr
+MayaUsdProxyShapeBase::_GetAsyncStage(
+    const std::string& filePath,
+    const SdfLayerRefPtr& sessionLayer,
+    const ArResolverContext& resolverContext,
+    UsdStage::InitialLoadSet loadSet)
+{
+    const _AsyncStageOpen::Key key(filePath, loadSet, sessionLayer);
+
+    // Pick up the stage of the request made by a previous compute.
+    if (_asyncStageOpen) {
+        std::shared_ptr<_AsyncStageOpen> request;
+        request.swap(_asyncStageOpen);
+
+        if (request->key == key) {
+            std::lock_guard<std::mutex> lock(request->mutex);
+            if (request->done) {
+                return request->stage;
+            }
+            _asyncStageOpen = request;
+            return nullptr;
+        }
+    }
+
+    // Stages already opened by another proxy shape don't need a worker.
+    if (_FindCachedStage(filePath, sessionLayer, resolverContext, loadSet)) {
+        return _OpenStage(filePath, sessionLayer, resolverContext, loadSet);
+    }
+
+    const std::string nodeUuid = MFnDependencyNode(thisMObject()).uuid().asString().asChar();
+
+    std::shared_ptr<_AsyncStageOpen> request;
+    bool dispatch = false;
+    {
+        std::lock_guard<std::mutex> lock(_AsyncStageOpen::registryMutex);
+
+        auto& entry = _AsyncStageOpen::registry[key];
+        request = entry.lock();
+        if (!request) {
+            request = std::make_shared<_AsyncStageOpen>();
+            request->key = key;
+            entry = request;
+            dispatch = true;
+        }
+
+        // Drop the requests no proxy shape waits for anymore.
+        for (auto it = _AsyncStageOpen::registry.begin(); it != _AsyncStageOpen::registry.end(); ) {
+            if (it->second.expired()) {
+                it = _AsyncStageOpen::registry.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(request->mutex);
+        if (request->done) {
+            return request->stage;
+        }
+        request->nodeUuids.push_back(nodeUuid);
+    }
+
+    _asyncStageOpen = request;
+
+    if (dispatch) {
+        TF_DEBUG(USDMAYA_PROXYSHAPEBASE).Msg(
+            "ProxyShapeBase::loadStage opening %s on a worker thread\n", filePath.c_str());
+
+        WorkRunDetachedTask([request, filePath, sessionLayer, resolverContext, loadSet]() {
+            UsdStageRefPtr usdStage =
+                _OpenUncachedStage(filePath, sessionLayer, resolverContext, loadSet);
+
+            // Warm up the stage before inserting it in the stage cache. Until
+            // then, no proxy shape or other client can get the stage, so
+            // nothing reads or edits it during the warm-up.
+            if (usdStage && UsdMayaStageWarmUp::IsEnabled()) {
+                auto warmUp = std::make_shared<UsdMayaStageWarmUp>(usdStage);
+                {
+                    std::lock_guard<std::mutex> lock(request->mutex);
+                    request->warmUp = warmUp;
+                }
+                warmUp->Run([usdStage](size_t processedPrimCount, size_t primCount) {
+                    _PostWarmUpNotice(usdStage, processedPrimCount, primCount);
+                });
+            }
+
+            if (usdStage) {
+                usdStage = _InsertCachedStage(
+                    usdStage, filePath, sessionLayer, resolverContext, loadSet);
+            }
+
+            std::vector<std::string> nodeUuids;
+            {
+                std::lock_guard<std::mutex> lock(request->mutex);
+                request->stage = usdStage;
+                request->warmUp.reset();
+                request->done = true;
+                nodeUuids.swap(request->nodeUuids);
+            }
+
+            // Dirty the waiting proxy shapes from the main thread. They are
+            // found by UUID since they may have been renamed or deleted.
+            for (const std::string& nodeUuid : nodeUuids) {
+                MGlobal::executeCommandOnIdle(MString(TfStringPrintf(
+                    "{ string $nodes[] = `ls \"%s\"`;"
+                    " if (size($nodes)) dgdirty ($nodes[0] + \".filePath\"); }",
+                    nodeUuid.c_str()).c_str()));
+            }
+        });
+    }
+
+    return nullptr;
+}
+
 MStatus
 MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
 {
@@ -726,7 +1090,9 @@ MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
             std::bind(&MayaUsdProxyShapeBase::_OnStageObjectsChanged,
                 this,
                 std::placeholders::_1));
-        
+
+        _ReleasePersistedBoundingBoxes();
+
         MayaUsdProxyStageSetNotice(*this).Send();
     }
 
@@ -754,7 +1120,7 @@ MayaUsdProxyShapeBase::computeOutputTime(MDataBlock& dataBlock)
 bool
 MayaUsdProxyShapeBase::isBounded() const
 {
-    return isStageValid();
+    return !_persistedBoundingBoxes.boxes.empty() || isStageValid();
 }
 
 /* virtual */
@@ -762,6 +1128,27 @@ void
 MayaUsdProxyShapeBase::CacheEmptyBoundingBox(MBoundingBox&)
 {}
 
+/* virtual */
+SdfLayerRefPtr
+MayaUsdProxyShapeBase::GetInitialSessionLayer(MDataBlock& dataBlock)
+{
+    return computeSessionLayer(dataBlock);
+}
+
+/* virtual */
+bool
+MayaUsdProxyShapeBase::GetInitialLoadPayloads(MDataBlock dataBlock) const
+{
+    return dataBlock.inputValue(loadPayloadsAttr).asBool();
+}
+
+void
+MayaUsdProxyShapeBase::_ReleasePersistedBoundingBoxes()
+{
+    // The bounding boxes are computed from the stage from now on.
+    _persistedBoundingBoxes = _PersistedBoundingBoxes();
+}
+
 /* virtual */
 UsdTimeCode
 MayaUsdProxyShapeBase::GetOutputTime(MDataBlock dataBlock) const
@@ -777,9 +1164,17 @@ MayaUsdProxyShapeBase::boundingBox() const
 
     MStatus status;
 
-    // Make sure outStage is up to date
     MayaUsdProxyShapeBase* nonConstThis = const_cast<ThisClass*>(this);
     MDataBlock dataBlock = nonConstThis->forceCache();
+
+    // Serve the bounding box saved with the scene until the stage gets
+    // composed, which is deferred until the stage needs to be drawn.
+    MBoundingBox persistedBoundingBox;
+    if (_GetPersistedBoundingBox(dataBlock, &persistedBoundingBox)) {
+        return persistedBoundingBox;
+    }
+
+    // Make sure outStage is up to date
     dataBlock.inputValue(outStageDataAttr, &status);
     CHECK_MSTATUS_AND_RETURN(status, MBoundingBox());
 
@@ -852,6 +1247,204 @@ MayaUsdProxyShapeBase::clearBoundingBoxCache()
     _boundingBoxCache.clear();
 }
 
+bool
+MayaUsdProxyShapeBase::_GetPersistedBoundingBox(
+        MDataBlock dataBlock,
+        MBoundingBox* boundingBox) const
+{
+    if (_persistedBoundingBoxes.boxes.empty()) {
+        return false;
+    }
+
+    // The saved bounding boxes only apply to the stage opened from the same
+    // file, with the same prim, purposes, payloads and session layer.
+    if (MPlug(thisMObject(), inStageDataAttr).isConnected()) {
+        return false;
+    }
+
+    MStatus status;
+    const MString filePath = dataBlock.inputValue(filePathAttr, &status).asString();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+    const MString primPath = dataBlock.inputValue(primPathAttr, &status).asString();
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    _GetDrawPurposeToggles(
+        dataBlock,
+        &drawRenderPurpose,
+        &drawProxyPurpose,
+        &drawGuidePurpose);
+
+    if (_persistedBoundingBoxes.filePath != filePath.asChar() ||
+        _persistedBoundingBoxes.primPath != primPath.asChar() ||
+        _persistedBoundingBoxes.purposes !=
+            _GetPurposeMask(drawRenderPurpose, drawProxyPurpose, drawGuidePurpose) ||
+        _persistedBoundingBoxes.loadPayloads != GetInitialLoadPayloads(dataBlock)) {
+        return false;
+    }
+
+    MayaUsdProxyShapeBase* nonConstThis = const_cast<MayaUsdProxyShapeBase*>(this);
+    if (_persistedBoundingBoxes.sessionLayerHash !=
+            _GetSessionLayerHash(nonConstThis->GetInitialSessionLayer(dataBlock))) {
+        return false;
+    }
+
+    const auto it = _persistedBoundingBoxes.boxes.find(GetOutputTime(dataBlock));
+    if (it == _persistedBoundingBoxes.boxes.end()) {
+        return false;
+    }
+
+    *boundingBox = it->second;
+    return true;
+}
+
+// The bounding boxes are saved as lines of text: the file path, the prim path
+// and the purposes of the shape, whether payloads are loaded, the hash of the
+// session layer content, the number of other layers used by the stage followed
+// by the modification time and the path of each layer, then the time and the
+// corners of each bounding box.
+std::string
+MayaUsdProxyShapeBase::_SerializeBoundingBoxCache() const
+{
+    if (!TfGetEnvSetting(MAYAUSD_PERSIST_BOUNDING_BOXES) ||
+        MPlug(thisMObject(), inStageDataAttr).isConnected()) {
+        return std::string();
+    }
+
+    const UsdStageRefPtr stage = getUsdStage();
+    if (!stage || stage->GetRootLayer()->IsAnonymous()) {
+        return std::string();
+    }
+
+    MayaUsdProxyShapeBase* nonConstThis = const_cast<MayaUsdProxyShapeBase*>(this);
+    MDataBlock dataBlock = nonConstThis->forceCache();
+
+    // Payloads loaded or unloaded since the stage got opened aren't restored
+    // when the scene gets opened again.
+    const bool loadPayloads = GetInitialLoadPayloads(dataBlock);
+    if (stage->GetLoadRules() != (loadPayloads ?
+            UsdStageLoadRules::LoadAll() : UsdStageLoadRules::LoadNone())) {
+        return std::string();
+    }
+
+    // Bounding boxes computed from unsaved edits can't be validated when the
+    // scene gets opened again. The session layer is validated by content.
+    const SdfLayerHandle sessionLayer = stage->GetSessionLayer();
+    std::vector<std::pair<double, std::string>> layerStamps;
+    for (const SdfLayerHandle& layer : stage->GetUsedLayers()) {
+        if (layer == sessionLayer) {
+            continue;
+        }
+        if (layer->IsDirty()) {
+            return std::string();
+        }
+        if (layer->IsAnonymous()) {
+            continue;
+        }
+
+        double modificationTime = 0.0;
+        const std::string& realPath = layer->GetRealPath();
+        if (realPath.empty() ||
+            !ArchGetModificationTime(realPath.c_str(), &modificationTime)) {
+            return std::string();
+        }
+        layerStamps.emplace_back(modificationTime, realPath);
+    }
+
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    _GetDrawPurposeToggles(
+        dataBlock,
+        &drawRenderPurpose,
+        &drawProxyPurpose,
+        &drawGuidePurpose);
+
+    std::ostringstream out;
+    out << dataBlock.inputValue(filePathAttr).asString().asChar() << '\n'
+        << dataBlock.inputValue(primPathAttr).asString().asChar() << '\n'
+        << _GetPurposeMask(drawRenderPurpose, drawProxyPurpose, drawGuidePurpose) << '\n'
+        << loadPayloads << '\n'
+        << _GetSessionLayerHash(sessionLayer) << '\n'
+        << layerStamps.size() << '\n';
+    for (const auto& layerStamp : layerStamps) {
+        out << TfStringPrintf("%.17g ", layerStamp.first) << layerStamp.second << '\n';
+    }
+
+    size_t boxCount = 0;
+    for (const auto& entry : _boundingBoxCache) {
+        if (entry.first.IsDefault()) {
+            continue;
+        }
+        if (boxCount++ == kMaxPersistedBoundingBoxes) {
+            break;
+        }
+
+        const MPoint boxMin = entry.second.min();
+        const MPoint boxMax = entry.second.max();
+        out << TfStringPrintf("%.17g %.17g %.17g %.17g %.17g %.17g %.17g\n",
+            entry.first.GetValue(),
+            boxMin.x, boxMin.y, boxMin.z,
+            boxMax.x, boxMax.y, boxMax.z);
+    }
+
+    return out.str();
+}
+
+void
+MayaUsdProxyShapeBase::_ParsePersistedBoundingBoxes(const std::string& data)
+{
+    _persistedBoundingBoxes = _PersistedBoundingBoxes();
+
+    if (data.empty() || !TfGetEnvSetting(MAYAUSD_PERSIST_BOUNDING_BOXES)) {
+        return;
+    }
+
+    _PersistedBoundingBoxes persisted;
+    persisted.data = data;
+
+    std::istringstream in(data);
+    size_t layerCount = 0;
+    if (!std::getline(in, persisted.filePath) ||
+        !std::getline(in, persisted.primPath) ||
+        !(in >> persisted.purposes >> persisted.loadPayloads >>
+              persisted.sessionLayerHash >> layerCount)) {
+        return;
+    }
+
+    // Drop the bounding boxes if any of the layers changed since they were
+    // computed. This only stats the layer files, none of them gets opened.
+    for (size_t i = 0; i < layerCount; ++i) {
+        double savedModificationTime = 0.0;
+        std::string realPath;
+        in >> savedModificationTime;
+        in.get();
+        std::getline(in, realPath);
+
+        double modificationTime = 0.0;
+        if (!in ||
+            !ArchGetModificationTime(realPath.c_str(), &modificationTime) ||
+            modificationTime != savedModificationTime) {
+            TF_DEBUG(USDMAYA_PROXYSHAPEBASE).Msg(
+                "ProxyShapeBase discarded the saved bounding boxes, %s changed\n",
+                realPath.c_str());
+            return;
+        }
+    }
+
+    double time = 0.0;
+    double minX, minY, minZ, maxX, maxY, maxZ;
+    while (in >> time >> minX >> minY >> minZ >> maxX >> maxY >> maxZ) {
+        persisted.boxes[UsdTimeCode(time)] = MBoundingBox(
+            MPoint(minX, minY, minZ),
+            MPoint(maxX, maxY, maxZ));
+    }
+
+    _persistedBoundingBoxes = std::move(persisted);
+}
+
 bool
 MayaUsdProxyShapeBase::isStageValid() const
 {
@@ -1038,6 +1631,15 @@ MayaUsdProxyShapeBase::_GetTime(MDataBlock dataBlock) const
 UsdStageRefPtr
 MayaUsdProxyShapeBase::getUsdStage() const
 {
+    // The stage is needed now, stop warming it up so that it gets picked up
+    // as soon as possible.
+    if (_asyncStageOpen) {
+        std::lock_guard<std::mutex> lock(_asyncStageOpen->mutex);
+        if (_asyncStageOpen->warmUp) {
+            _asyncStageOpen->warmUp->Cancel();
+        }
+    }
+
     MStatus localStatus;
     MayaUsdProxyShapeBase* nonConstThis = const_cast<MayaUsdProxyShapeBase*>(this);
     MDataBlock dataBlock = nonConstThis->forceCache();
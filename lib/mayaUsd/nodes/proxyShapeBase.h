@@ -16,7 +16,10 @@
 #ifndef PXRUSDMAYA_PROXY_SHAPE_BASE_H
 #define PXRUSDMAYA_PROXY_SHAPE_BASE_H
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <string>
 
 #include <maya/MBoundingBox.h>
 #include <maya/MDagPath.h>
@@ -36,9 +39,12 @@
 #include <pxr/base/gf/ray.h>
 #include <pxr/base/gf/vec3d.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/usd/ar/resolverContext.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
 
 #if defined(WANT_UFE_BUILD)
@@ -109,6 +115,8 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
         static MObject drawProxyPurposeAttr;
         MAYAUSD_CORE_PUBLIC
         static MObject drawGuidePurposeAttr;
+        MAYAUSD_CORE_PUBLIC
+        static MObject persistedBoundingBoxesAttr;
 
         // Output attributes
         MAYAUSD_CORE_PUBLIC
@@ -176,6 +184,17 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
         MAYAUSD_CORE_PUBLIC
         bool canMakeLive() const override;
 
+        MAYAUSD_CORE_PUBLIC
+        bool getInternalValueInContext(
+                const MPlug& plug,
+                MDataHandle& dataHandle,
+                MDGContext& ctx) override;
+        MAYAUSD_CORE_PUBLIC
+        bool setInternalValueInContext(
+                const MPlug& plug,
+                const MDataHandle& dataHandle,
+                MDGContext& ctx) override;
+
         // Public functions
         MAYAUSD_CORE_PUBLIC
         virtual SdfPathVector getExcludePrimPaths() const;
@@ -302,6 +321,24 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
         MAYAUSD_CORE_PUBLIC
         virtual UsdTimeCode GetOutputTime(MDataBlock) const;
 
+        // Hook method for derived classes: the session layer the stage gets
+        // opened with, checked against the bounding boxes saved with the
+        // scene.  This class returns computeSessionLayer().
+        MAYAUSD_CORE_PUBLIC
+        virtual SdfLayerRefPtr GetInitialSessionLayer(MDataBlock&);
+
+        // Hook method for derived classes: whether the stage gets opened
+        // with its payloads loaded.  This class returns the value of the
+        // loadPayloads attribute.
+        MAYAUSD_CORE_PUBLIC
+        virtual bool GetInitialLoadPayloads(MDataBlock) const;
+
+        // Drop the bounding boxes saved with the scene.  Derived classes
+        // computing their own output stage call this whenever they change
+        // the stage.
+        MAYAUSD_CORE_PUBLIC
+        void _ReleasePersistedBoundingBoxes();
+
         MAYAUSD_CORE_PUBLIC
         void _IncreaseExcludePrimPathsVersion() { _excludePrimPathsVersion++; }
 
@@ -314,6 +351,11 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
 
         MStatus computeOutputTime(MDataBlock& dataBlock);
         MStatus computeInStageDataCached(MDataBlock& dataBlock);
+        UsdStageRefPtr _GetAsyncStage(
+                const std::string& filePath,
+                const SdfLayerRefPtr& sessionLayer,
+                const ArResolverContext& resolverContext,
+                UsdStage::InitialLoadSet loadSet);
         MStatus computeOutStageData(MDataBlock& dataBlock);
 
         SdfPathVector _GetExcludePrimPaths(MDataBlock dataBlock) const;
@@ -326,6 +368,12 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
                 bool* drawProxyPurpose,
                 bool* drawGuidePurpose) const;
 
+        bool _GetPersistedBoundingBox(
+                MDataBlock dataBlock,
+                MBoundingBox* boundingBox) const;
+        std::string _SerializeBoundingBoxCache() const;
+        void _ParsePersistedBoundingBoxes(const std::string& data);
+
         void _OnStageContentsChanged(
                 const UsdNotice::StageContentsChanged& notice);
         void _OnStageObjectsChanged(
@@ -334,11 +382,29 @@ class MayaUsdProxyShapeBase : public MPxSurfaceShape,
         UsdMayaStageNoticeListener _stageNoticeListener;
 
         std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
+
+        // Bounding boxes saved with the scene, served by boundingBox() until
+        // the stage gets composed. See persistedBoundingBoxesAttr.
+        struct _PersistedBoundingBoxes
+        {
+            std::string                         data;
+            std::string                         filePath;
+            std::string                         primPath;
+            unsigned int                        purposes{ 0 };
+            bool                                loadPayloads{ true };
+            uint64_t                            sessionLayerHash{ 0 };
+            std::map<UsdTimeCode, MBoundingBox> boxes;
+        };
+        _PersistedBoundingBoxes             _persistedBoundingBoxes;
         size_t                              _excludePrimPathsVersion{ 1 };
         size_t                              _UsdStageVersion{ 1 };
 
         MAYAUSD_NS::ProxyAccessor::Owner    _usdAccessor;
 
+        // Stage being opened on a worker thread, see _GetAsyncStage()
+        struct _AsyncStageOpen;
+        std::shared_ptr<_AsyncStageOpen>    _asyncStageOpen;
+
         static ClosestPointDelegate _sharedClosestPointDelegate;
 
         // Whether or not the proxy shape has enabled UFE/subpath selection
@@ -27,8 +27,11 @@ TF_WRAP_MODULE {
     TF_WRAP(ConverterArgs);
     TF_WRAP(DiagnosticDelegate);
     TF_WRAP(MeshWriteUtils);
+    TF_WRAP(PlaybackCache);
+    TF_WRAP(PrimvarPrefetcher);
     TF_WRAP(Query);
     TF_WRAP(ReadUtil);
+    TF_WRAP(ResourceRegistry);
     TF_WRAP(RoundTripUtil);
     TF_WRAP(StageCache);
     TF_WRAP(UserTaggedAttribute);
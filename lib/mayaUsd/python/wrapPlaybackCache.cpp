@@ -0,0 +1,97 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/python.hpp>
+
+#include <pxr/pxr.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <mayaUsd/render/vp2RenderDelegate/playbackCache.h>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE;
+
+namespace {
+
+// Record points as a vertex buffer would be.
+void _Store(
+    HdVP2PlaybackCache& cache,
+    const SdfPath& rprimId,
+    const TfToken& bufferName,
+    UsdTimeCode time,
+    const VtVec3fArray& points)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(points.cdata());
+    cache.Store(rprimId, bufferName, time,
+        std::vector<uint8_t>(data, data + points.size() * sizeof(GfVec3f)));
+}
+
+// Return the recorded points, or an empty array if no data of the expected
+// size was recorded.
+VtVec3fArray _Find(
+    HdVP2PlaybackCache& cache,
+    const SdfPath& rprimId,
+    const TfToken& bufferName,
+    UsdTimeCode time,
+    size_t numPoints)
+{
+    const size_t sizeInBytes = numPoints * sizeof(GfVec3f);
+    const void* data = cache.Find(rprimId, bufferName, time, sizeInBytes);
+    if (!data) {
+        return VtVec3fArray();
+    }
+
+    VtVec3fArray points(numPoints);
+    memcpy(points.data(), data, sizeInBytes);
+    return points;
+}
+
+} // namespace
+
+void wrapPlaybackCache()
+{
+    typedef HdVP2PlaybackCache This;
+    scope cacheScope = class_<This, boost::noncopyable>("PlaybackCache", init<size_t>())
+        .def("Store", &_Store)
+        .def("Find", &_Find)
+        .def("Clear", &This::Clear)
+        .def("SetActive", &This::SetActive)
+        .def("IsActive", &This::IsActive)
+        .def("IsRecording", &This::IsRecording)
+        .def("GetMemoryUsage", &This::GetMemoryUsage)
+        .def("GetGlobalStats", &This::GetGlobalStats)
+        .staticmethod("GetGlobalStats")
+        .def("ResetGlobalStats", &This::ResetGlobalStats)
+        .staticmethod("ResetGlobalStats")
+        ;
+
+    typedef This::Stats Stats;
+    class_<Stats>("Stats", no_init)
+        .def_readonly("hits", &Stats::hits)
+        .def_readonly("misses", &Stats::misses)
+        .def_readonly("stores", &Stats::stores)
+        .def_readonly("clears", &Stats::clears)
+        ;
+}
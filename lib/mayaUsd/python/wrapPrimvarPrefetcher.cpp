@@ -0,0 +1,45 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <boost/noncopyable.hpp>
+#include <boost/python.hpp>
+
+#include <pxr/pxr.h>
+
+#include <mayaUsd/render/vp2RenderDelegate/primvarPrefetcher.h>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE;
+
+void wrapPrimvarPrefetcher()
+{
+    typedef HdVP2PrimvarPrefetcher This;
+    scope prefetcherScope = class_<This, boost::noncopyable>("PrimvarPrefetcher", no_init)
+        .def("GetGlobalStats", &This::GetGlobalStats)
+        .staticmethod("GetGlobalStats")
+        .def("ResetGlobalStats", &This::ResetGlobalStats)
+        .staticmethod("ResetGlobalStats")
+        ;
+
+    typedef This::Stats Stats;
+    class_<Stats>("Stats", no_init)
+        .def_readonly("hits", &Stats::hits)
+        .def_readonly("misses", &Stats::misses)
+        .def_readonly("frames", &Stats::frames)
+        .def_readonly("cancellations", &Stats::cancellations)
+        .def("HitRate", &Stats::HitRate)
+        ;
+}
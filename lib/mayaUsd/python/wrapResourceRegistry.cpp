@@ -0,0 +1,89 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <boost/noncopyable.hpp>
+#include <boost/python.hpp>
+
+#include <pxr/pxr.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/smoothNormals.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/imaging/pxOsd/tokens.h>
+
+#include <mayaUsd/render/vp2RenderDelegate/resource_registry.h>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE;
+
+namespace {
+
+// Vertex adjacency table handed out by the registry. Tables compare equal
+// when they are shared.
+class _PyVertexAdjacency
+{
+public:
+    _PyVertexAdjacency(const Hd_VertexAdjacencySharedPtr& adjacency)
+        : _adjacency(adjacency)
+    {
+    }
+
+    VtVec3fArray ComputeSmoothNormals(const VtVec3fArray& points) const
+    {
+        return Hd_SmoothNormals::ComputeSmoothNormals(
+            _adjacency.get(), static_cast<int>(points.size()), points.cdata());
+    }
+
+    bool operator==(const _PyVertexAdjacency& other) const
+    {
+        return _adjacency == other._adjacency;
+    }
+
+    bool operator!=(const _PyVertexAdjacency& other) const
+    {
+        return _adjacency != other._adjacency;
+    }
+
+private:
+    Hd_VertexAdjacencySharedPtr _adjacency;
+};
+
+_PyVertexAdjacency _GetVertexAdjacency(
+    HdVP2ResourceRegistry& registry,
+    const VtIntArray& faceVertexCounts,
+    const VtIntArray& faceVertexIndices)
+{
+    const HdMeshTopology topology(
+        PxOsdOpenSubdivTokens->none, HdTokens->rightHanded,
+        faceVertexCounts, faceVertexIndices);
+    return _PyVertexAdjacency(registry.GetVertexAdjacency(topology));
+}
+
+} // namespace
+
+void wrapResourceRegistry()
+{
+    typedef HdVP2ResourceRegistry This;
+    class_<This, boost::noncopyable>("ResourceRegistry", init<>())
+        .def("GetVertexAdjacency", &_GetVertexAdjacency)
+        ;
+
+    class_<_PyVertexAdjacency>("VertexAdjacency", no_init)
+        .def("ComputeSmoothNormals", &_PyVertexAdjacency::ComputeSmoothNormals)
+        .def(self == self)
+        .def(self != self)
+        ;
+}
@@ -23,6 +23,8 @@ TF_REGISTRY_FUNCTION(TfDebug)
 {
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MATERIAL, "Debug material");
     TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_MESH, "Debug mesh");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_PLAYBACK_CACHE, "Debug RAM playback cache");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(HDVP2_DEBUG_PREFETCH, "Debug playback primvar prefetching");
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -24,7 +24,9 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEBUG_CODES(
     HDVP2_DEBUG_MATERIAL,
-    HDVP2_DEBUG_MESH
+    HDVP2_DEBUG_MESH,
+    HDVP2_DEBUG_PLAYBACK_CACHE,
+    HDVP2_DEBUG_PREFETCH
 );
 
 PXR_NAMESPACE_CLOSE_SCOPE
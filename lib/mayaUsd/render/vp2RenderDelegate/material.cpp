@@ -105,6 +105,44 @@ inline bool _IsUsdUVTexture(const HdMaterialNode& node)
     return (node.identifier == UsdImagingTokens->UsdUVTexture);
 }
 
+//! Helper utility function to describe the topology of the specified material
+//! network, i.e. everything which affects the fragment graph of its shader
+//! instance: node identifiers and names, connections, and primvar names read
+//! by primvar readers. Networks with the same topology only differ by their
+//! parameter values.
+std::string _GetNetworkTopology(const HdMaterialNetwork& mat)
+{
+    std::string topology;
+
+    for (const HdMaterialNode& node : mat.nodes) {
+        topology += node.identifier.GetString();
+        topology += ' ';
+        topology += node.path.GetName();
+
+        if (_IsUsdPrimvarReader(node)) {
+            auto it = node.parameters.find(_tokens->varname);
+            if (it != node.parameters.end()) {
+                topology += ' ';
+                topology += TfStringify(it->second);
+            }
+        }
+        topology += '\n';
+    }
+
+    for (const HdMaterialRelationship& rel : mat.relationships) {
+        topology += rel.inputId.GetName();
+        topology += '.';
+        topology += rel.inputName.GetString();
+        topology += "->";
+        topology += rel.outputId.GetName();
+        topology += '.';
+        topology += rel.outputName.GetString();
+        topology += '\n';
+    }
+
+    return topology;
+}
+
 //! Helper utility function to print nodes, connections and primvars in the
 //! specified material network.
 void _PrintMaterialNetwork(
@@ -588,8 +626,29 @@ void HdVP2Material::Sync(
                 HdMaterialNetwork vp2BxdfNet;
                 _ApplyVP2Fixes(vp2BxdfNet, bxdfNet);
 
-                // Create a shader instance for the material network.
-                _surfaceShader.reset(_CreateShaderInstance(vp2BxdfNet));
+                // Materials with the same network topology share the same
+                // fragment graph. Clone the shader instance cached for the
+                // topology if any, its parameter values are then updated like
+                // for a new shader instance. Otherwise create a shader instance
+                // for the material network and cache a pristine clone of it.
+                const std::string topology = _GetNetworkTopology(vp2BxdfNet);
+                MHWRender::MShaderInstance* cachedShader =
+                    _renderDelegate->GetMaterialShader(topology);
+                if (cachedShader && !vp2BxdfNet.nodes.empty()) {
+                    TF_DEBUG(HDVP2_DEBUG_MATERIAL).Msg(
+                        "Cloning cached shader instance for %s\n", id.GetText());
+
+                    _surfaceShader.reset(cachedShader->clone());
+                    _surfaceShaderId = vp2BxdfNet.nodes.back().path;
+                }
+                else {
+                    _surfaceShader.reset(_CreateShaderInstance(vp2BxdfNet));
+
+                    if (_surfaceShader) {
+                        _renderDelegate->AddMaterialShader(
+                            topology, _surfaceShader->clone());
+                    }
+                }
 
                 if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
                     _PrintMaterialNetwork("BXDF", id, bxdfNet);
@@ -17,6 +17,7 @@
 
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 #include <maya/MMatrix.h>
 #include <maya/MProfiler.h>
@@ -34,6 +35,8 @@
 #include "draw_item.h"
 #include "instancer.h"
 #include "material.h"
+#include "playbackCache.h"
+#include "primvarPrefetcher.h"
 #include "render_delegate.h"
 #include "tokens.h"
 
@@ -112,6 +115,31 @@ namespace {
         CommitState() = delete;
     };
 
+    //! \brief  Helper utility function to fill a vertex buffer acquired with write-only access,
+    //!         recording its data in the playback cache while playback is running.
+    //!
+    //! The acquired buffer can't be read back, so the recorded data is filled in CPU memory and
+    //! then copied into the buffer.
+    template <class FILL_FUNC>
+    void _FillVertexBuffer(void* bufferData,
+        size_t bufferSize,
+        HdVP2PlaybackCache* playbackCache,
+        const SdfPath& rprimId,
+        const TfToken& bufferName,
+        UsdTimeCode time,
+        FILL_FUNC fill)
+    {
+        if (playbackCache && playbackCache->IsRecording()) {
+            std::vector<uint8_t> recordedData(bufferSize);
+            fill(recordedData.data());
+            memcpy(bufferData, recordedData.data(), bufferSize);
+            playbackCache->Store(rprimId, bufferName, time, std::move(recordedData));
+        }
+        else {
+            fill(bufferData);
+        }
+    }
+
     //! Helper utility function to fill primvar data to vertex buffer.
     template <class DEST_TYPE, class SRC_TYPE>
     void _FillPrimvarData(DEST_TYPE* vertexBuffer,
@@ -378,6 +406,7 @@ void HdVP2Mesh::Sync(
 
     if (HdChangeTracker::IsTopologyDirty(*dirtyBits, id)) {
         _meshSharedData._topology = GetMeshTopology(delegate);
+        _meshSharedData._adjacency.reset();
 
         const HdMeshTopology& topology = _meshSharedData._topology;
         const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
@@ -435,18 +464,41 @@ void HdVP2Mesh::Sync(
     // Prepare position buffer. It is shared among all draw items so it should
     // be updated only once when it gets dirty.
     if (HdChangeTracker::IsPrimvarDirty(*dirtyBits, id, HdTokens->points)) {
-        const VtValue value = delegate->Get(id, HdTokens->points);
-        _meshSharedData._points = value.Get<VtVec3fArray>();
-
         const HdMeshTopology& topology = _meshSharedData._topology;
         const size_t numVertices = _meshSharedData._numVertices;
+        const size_t bufferSize = numVertices * sizeof(GfVec3f);
+
+        // Points recorded by the playback cache don't need to be pulled, unless
+        // they were never pulled before and are still required to enable draw
+        // items. They are pulled later if needed to compute smooth normals.
+        HdVP2PlaybackCache* const playbackCache = drawScene.GetPlaybackCache();
+        const void* cachedData = (playbackCache && !_meshSharedData._points.empty()) ?
+            playbackCache->Find(id, HdTokens->points, param->GetFrame(), bufferSize) : nullptr;
+
+        if (!cachedData) {
+            VtValue value;
+            if (!_ConsumePrefetchedPrimvar(HdTokens->points, &value)) {
+                value = delegate->Get(id, HdTokens->points);
+            }
+            _meshSharedData._points = value.Get<VtVec3fArray>();
+        }
+        _meshSharedData._pointsOutOfDate = (cachedData != nullptr);
 
         void* bufferData = _meshSharedData._positionsBuffer->acquire(numVertices, true);
         if (bufferData) {
-            _FillPrimvarData(static_cast<GfVec3f*>(bufferData),
-                numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
-                _rprimId, topology,
-                HdTokens->points, _meshSharedData._points, HdInterpolationVertex);
+            if (cachedData) {
+                memcpy(bufferData, cachedData, bufferSize);
+            }
+            else {
+                _FillVertexBuffer(bufferData, bufferSize, playbackCache,
+                    id, HdTokens->points, param->GetFrame(),
+                    [&](void* data) {
+                        _FillPrimvarData(static_cast<GfVec3f*>(data),
+                            numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
+                            _rprimId, topology,
+                            HdTokens->points, _meshSharedData._points, HdInterpolationVertex);
+                    });
+            }
 
             // Capture class member for lambda
             MHWRender::MVertexBuffer* const positionsBuffer =
@@ -903,6 +955,11 @@ void HdVP2Mesh::_UpdateDrawItem(
 
         bool prepareNormals = false;
 
+        // Normals recorded by the playback cache don't need to be computed.
+        HdVP2PlaybackCache* const playbackCache = drawScene.GetPlaybackCache();
+        const size_t normalsBufferSize = numVertices * sizeof(GfVec3f);
+        const void* cachedNormals = nullptr;
+
         // If there is authored normals, prepare buffer only when it is dirty.
         // otherwise, compute smooth normals from points and adjacency and we
         // have a custom dirty bit to determine whether update is needed.
@@ -910,25 +967,41 @@ void HdVP2Mesh::_UpdateDrawItem(
             prepareNormals = ((itemDirtyBits & HdChangeTracker::DirtyNormals) != 0);
         }
         else if (requireSmoothNormals && (itemDirtyBits & DirtySmoothNormals)) {
-            // note: normals gets dirty when points are marked as dirty,
-            // at change tracker.
-            // HdC_TODO: move the normals computation to GPU to save expensive
-            // computation and buffer transfer.
-            Hd_VertexAdjacencySharedPtr adjacency(new Hd_VertexAdjacency());
-            HdBufferSourceSharedPtr adjacencyComputation =
-                adjacency->GetSharedAdjacencyBuilderComputation(&topology);
-            adjacencyComputation->Resolve(); // IS the adjacency updated now?
-
-            // Only the points referenced by the topology are used to compute
-            // smooth normals.
-            normals = Hd_SmoothNormals::ComputeSmoothNormals(
-                adjacency.get(),
-                _meshSharedData._points.size(),
-                _meshSharedData._points.cdata());
+            if (playbackCache) {
+                cachedNormals = playbackCache->Find(
+                    id, HdTokens->normals, param->GetFrame(), normalsBufferSize);
+            }
+
+            if (!cachedNormals) {
+                // Points were skipped for the position buffer filled from the
+                // playback cache, but they are needed now.
+                if (_meshSharedData._pointsOutOfDate) {
+                    _meshSharedData._points =
+                        sceneDelegate->Get(id, HdTokens->points).Get<VtVec3fArray>();
+                    _meshSharedData._pointsOutOfDate = false;
+                }
+
+                // note: normals gets dirty when points are marked as dirty,
+                // at change tracker. The adjacency only depends on topology,
+                // it is kept until topology gets dirty.
+                // HdC_TODO: move the normals computation to GPU to save expensive
+                // computation and buffer transfer.
+                if (!_meshSharedData._adjacency) {
+                    _meshSharedData._adjacency =
+                        _delegate->GetVP2ResourceRegistry().GetVertexAdjacency(topology);
+                }
+
+                // Only the points referenced by the topology are used to compute
+                // smooth normals. The computation is split over worker threads.
+                normals = Hd_SmoothNormals::ComputeSmoothNormals(
+                    _meshSharedData._adjacency.get(),
+                    _meshSharedData._points.size(),
+                    _meshSharedData._points.cdata());
+            }
 
             interp = HdInterpolationVertex;
 
-            prepareNormals = !normals.empty();
+            prepareNormals = (cachedNormals != nullptr) || !normals.empty();
         }
 
         if (prepareNormals) {
@@ -944,9 +1017,18 @@ void HdVP2Mesh::_UpdateDrawItem(
 
             void* bufferData = drawItemData._normalsBuffer->acquire(numVertices, true);
             if (bufferData) {
-                _FillPrimvarData(static_cast<GfVec3f*>(bufferData),
-                    numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
-                    _rprimId, topology, HdTokens->normals, normals, interp);
+                if (cachedNormals) {
+                    memcpy(bufferData, cachedNormals, normalsBufferSize);
+                }
+                else {
+                    _FillVertexBuffer(bufferData, normalsBufferSize, playbackCache,
+                        id, HdTokens->normals, param->GetFrame(),
+                        [&](void* data) {
+                            _FillPrimvarData(static_cast<GfVec3f*>(data),
+                                numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
+                                _rprimId, topology, HdTokens->normals, normals, interp);
+                        });
+                }
 
                 stateToCommit._normalsBufferData = bufferData;
             }
@@ -1037,15 +1119,30 @@ void HdVP2Mesh::_UpdateDrawItem(
                 void* bufferData =
                     drawItemData._colorBuffer->acquire(numVertices, true);
 
-                // Fill color and opacity into the float4 color stream.
+                // Fill color and opacity into the float4 color stream, or copy
+                // the stream recorded by the playback cache.
                 if (bufferData) {
-                    _FillPrimvarData(static_cast<GfVec4f*>(bufferData),
-                        numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
-                        _rprimId, topology, HdTokens->displayColor, colorArray, colorInterp);
+                    HdVP2PlaybackCache* const playbackCache = drawScene.GetPlaybackCache();
+                    const size_t bufferSize = numVertices * sizeof(GfVec4f);
+                    const void* cachedData = playbackCache ? playbackCache->Find(
+                        id, HdTokens->displayColor, param->GetFrame(), bufferSize) : nullptr;
 
-                    _FillPrimvarData(static_cast<GfVec4f*>(bufferData),
-                        numVertices, 3, _meshSharedData._renderingToSceneFaceVtxIds,
-                        _rprimId, topology, HdTokens->displayOpacity, alphaArray, alphaInterp);
+                    if (cachedData) {
+                        memcpy(bufferData, cachedData, bufferSize);
+                    }
+                    else {
+                        _FillVertexBuffer(bufferData, bufferSize, playbackCache,
+                            id, HdTokens->displayColor, param->GetFrame(),
+                            [&](void* data) {
+                                _FillPrimvarData(static_cast<GfVec4f*>(data),
+                                    numVertices, 0, _meshSharedData._renderingToSceneFaceVtxIds,
+                                    _rprimId, topology, HdTokens->displayColor, colorArray, colorInterp);
+
+                                _FillPrimvarData(static_cast<GfVec4f*>(data),
+                                    numVertices, 3, _meshSharedData._renderingToSceneFaceVtxIds,
+                                    _rprimId, topology, HdTokens->displayOpacity, alphaArray, alphaInterp);
+                            });
+                    }
 
                     stateToCommit._colorBufferData = bufferData;
                 }
@@ -1601,7 +1698,11 @@ void HdVP2Mesh::_UpdatePrimvarSources(
         for (const HdPrimvarDescriptor& pv: primvars) {
             if (std::find(begin, end, pv.name) != end) {
                 if (HdChangeTracker::IsPrimvarDirty(dirtyBits, id, pv.name)) {
-                    const VtValue value = GetPrimvar(sceneDelegate, pv.name);
+                    VtValue value;
+                    if (pv.name != HdTokens->normals ||
+                        !_ConsumePrefetchedPrimvar(pv.name, &value)) {
+                        value = GetPrimvar(sceneDelegate, pv.name);
+                    }
                     _meshSharedData._primvarSourceMap[pv.name] = { value, interp };
                 }
             }
@@ -1612,6 +1713,25 @@ void HdVP2Mesh::_UpdatePrimvarSources(
     }
 }
 
+/*! \brief  Get the value of a time-varying primvar from the look-ahead prefetcher.
+
+    The primvar gets registered for prefetching of the next frames when it is dirty during
+    playback, which means it is time-varying.
+
+    \return True if the prefetcher had the value for the current frame.
+*/
+bool HdVP2Mesh::_ConsumePrefetchedPrimvar(const TfToken& primvarName, VtValue* value)
+{
+    auto* const param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
+    HdVP2PrimvarPrefetcher* const prefetcher = param->GetDrawScene().GetPrimvarPrefetcher();
+    if (!prefetcher || !prefetcher->IsActive()) {
+        return false;
+    }
+
+    prefetcher->Register(GetId(), primvarName);
+    return prefetcher->Consume(GetId(), primvarName, param->GetFrame(), value);
+}
+
 /*! \brief  Create render item for points repr.
 */
 MHWRender::MRenderItem* HdVP2Mesh::_CreatePointsRenderItem(const MString& name) const
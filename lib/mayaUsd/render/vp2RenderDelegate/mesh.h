@@ -20,6 +20,7 @@
 
 #include <pxr/pxr.h>
 #include <pxr/imaging/hd/mesh.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
 
 #include <mayaUsd/render/vp2RenderDelegate/proxyRenderDelegate.h>
 
@@ -51,6 +52,10 @@ struct HdVP2MeshSharedData {
     //! copy.
     HdMeshTopology _topology;
 
+    //! Vertex adjacency of the scene topology used to compute smooth normals.
+    //! It is shared by all meshes with the same topology.
+    Hd_VertexAdjacencySharedPtr _adjacency;
+
     //! The rendering topology is to create unshared or sorted vertice layout
     //! for efficient GPU rendering.
     HdMeshTopology _renderingTopology;
@@ -71,6 +76,10 @@ struct HdVP2MeshSharedData {
     //! but a separate VtArray for easier access.
     VtVec3fArray _points;
 
+    //! True when the position buffer was filled from the playback cache and
+    //! the points of the current frame haven't been pulled.
+    bool _pointsOutOfDate{ false };
+
     //! Position buffer of the Rprim to be shared among all its draw items.
     std::unique_ptr<MHWRender::MVertexBuffer> _positionsBuffer;
 
@@ -124,6 +133,8 @@ private:
         HdDirtyBits dirtyBits,
         const TfTokenVector& requiredPrimvars);
 
+    bool _ConsumePrefetchedPrimvar(const TfToken& primvarName, VtValue* value);
+
     MHWRender::MRenderItem* _CreateSelectionHighlightRenderItem(const MString& name) const;
     MHWRender::MRenderItem* _CreateSmoothHullRenderItem(const MString& name) const;
     MHWRender::MRenderItem* _CreateWireframeRenderItem(const MString& name) const;
@@ -0,0 +1,171 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "playbackCache.h"
+
+#include <pxr/base/tf/debug.h>
+
+#include "debugCodes.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace
+{
+    //! Counters summed over all the playback caches
+    std::atomic<size_t> globalHits{ 0 };
+    std::atomic<size_t> globalMisses{ 0 };
+    std::atomic<size_t> globalStores{ 0 };
+    std::atomic<size_t> globalClears{ 0 };
+}
+
+/*! \brief  Constructor.
+
+    \param  budgetInBytes   Maximum memory used by the recorded frame data
+*/
+HdVP2PlaybackCache::HdVP2PlaybackCache(size_t budgetInBytes)
+    : _budget(budgetInBytes)
+{
+}
+
+/*! \brief  Find the data of a vertex buffer recorded for the given time. Call is thread safe.
+
+    The returned data remains valid until the cache gets cleared, which only happens on main
+    thread outside of rprim synchronization.
+
+    \return Pointer to the recorded data, null if no data of the expected size was recorded.
+*/
+const void* HdVP2PlaybackCache::Find(
+    const SdfPath& rprimId,
+    const TfToken& bufferName,
+    UsdTimeCode time,
+    size_t sizeInBytes)
+{
+    if (!_active || time.IsDefault()) {
+        return nullptr;
+    }
+
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(_mutex, false/*write*/);
+
+        // Elements of an unordered_map are not moved by insertions, so the
+        // data can be read after releasing the lock.
+        const auto it = _entries.find(_Key(rprimId, bufferName, time.GetValue()));
+        if (it != _entries.end() && it->second.size() == sizeInBytes) {
+            _hits++;
+            globalHits++;
+            return it->second.data();
+        }
+    }
+
+    _misses++;
+    globalMisses++;
+    return nullptr;
+}
+
+/*! \brief  Record the data of a vertex buffer filled for the given time. Call is thread safe.
+
+    The data must be filled in CPU memory, vertex buffers acquired with write-only access can't
+    be read back. Nothing is recorded once the memory budget is reached.
+*/
+void HdVP2PlaybackCache::Store(
+    const SdfPath& rprimId,
+    const TfToken& bufferName,
+    UsdTimeCode time,
+    std::vector<uint8_t>&& bufferData)
+{
+    const size_t sizeInBytes = bufferData.size();
+    if (!_active || time.IsDefault() || sizeInBytes == 0 || _budgetReached) {
+        return;
+    }
+
+    if (_memoryUsage + sizeInBytes > _budget) {
+        if (!_budgetReached.exchange(true)) {
+            TF_DEBUG(HDVP2_DEBUG_PLAYBACK_CACHE).Msg(
+                "Playback cache budget of %zu bytes reached, recording stopped\n", _budget);
+        }
+        return;
+    }
+
+    tbb::spin_rw_mutex::scoped_lock lock(_mutex, true/*write*/);
+
+    auto result = _entries.emplace(_Key(rprimId, bufferName, time.GetValue()), std::vector<uint8_t>());
+    _memoryUsage -= result.first->second.size();
+    result.first->second = std::move(bufferData);
+    _memoryUsage += sizeInBytes;
+
+    globalStores++;
+}
+
+/*! \brief  Drop all the recorded frame data. Call on main thread.
+*/
+void HdVP2PlaybackCache::Clear()
+{
+    if (_entries.empty()) {
+        return;
+    }
+
+    TF_DEBUG(HDVP2_DEBUG_PLAYBACK_CACHE).Msg(
+        "Playback cache cleared: %zu buffers, %zu bytes\n", _entries.size(), _memoryUsage.load());
+
+    tbb::spin_rw_mutex::scoped_lock lock(_mutex, true/*write*/);
+
+    _EntryMap().swap(_entries);
+    _memoryUsage = 0;
+    _budgetReached = false;
+
+    globalClears++;
+}
+
+/*! \brief  Enable or disable recording and fetching of frame data. Call on main thread before
+            rprims get synced.
+
+    Recorded data is kept while disabled so that the next playback can use it.
+*/
+void HdVP2PlaybackCache::SetActive(bool active)
+{
+    if (_active && !active) {
+        const size_t hits = _hits.exchange(0);
+        const size_t misses = _misses.exchange(0);
+        TF_DEBUG(HDVP2_DEBUG_PLAYBACK_CACHE).Msg(
+            "Playback stopped: %zu hits, %zu misses, %zu buffers, %zu bytes\n",
+            hits, misses, _entries.size(), _memoryUsage.load());
+    }
+
+    _active = active;
+}
+
+/*! \brief  Get the counters summed over all the playback caches of the process.
+*/
+HdVP2PlaybackCache::Stats HdVP2PlaybackCache::GetGlobalStats()
+{
+    Stats stats;
+    stats.hits = globalHits;
+    stats.misses = globalMisses;
+    stats.stores = globalStores;
+    stats.clears = globalClears;
+    return stats;
+}
+
+/*! \brief  Reset the counters summed over all the playback caches of the process.
+*/
+void HdVP2PlaybackCache::ResetGlobalStats()
+{
+    globalHits = 0;
+    globalMisses = 0;
+    globalStores = 0;
+    globalClears = 0;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
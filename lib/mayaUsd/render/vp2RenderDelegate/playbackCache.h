@@ -0,0 +1,129 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PLAYBACK_CACHE
+#define HD_VP2_PLAYBACK_CACHE
+
+#include <atomic>
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <tbb/spin_rw_mutex.h>
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <mayaUsd/base/api.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Keeps the vertex buffer data of animated rprims in memory for looped playback.
+    \class  HdVP2PlaybackCache
+
+    While playback is running, rprims record the content of the vertex buffers they fill for
+    time-varying data (see Store()). Vertex buffers are acquired with write-only access, so the
+    recorded data is filled in CPU memory and then copied into the acquired vertex buffer. When
+    the same frame is drawn again, e.g. at the next iteration of a playback loop, rprims copy the
+    recorded data into the acquired vertex buffer (see Find()) and skip the value resolution and
+    buffer preparation.
+
+    The memory used by the cache is bounded by a budget. Once the budget is reached, no new frame
+    data is recorded until the cache gets cleared. Keeping the frames recorded first instead of
+    evicting them guarantees hits for loops which don't fit in the budget, where evicting the
+    oldest frames would miss at every frame.
+
+    The owner is responsible for clearing the cache when the stage gets edited.
+*/
+class HdVP2PlaybackCache
+{
+public:
+    //! Counters exposed for profiling the playback cache
+    struct Stats
+    {
+        size_t hits{ 0 };       //!< Number of vertex buffers copied from recorded data
+        size_t misses{ 0 };     //!< Number of vertex buffers not found in recorded data
+        size_t stores{ 0 };     //!< Number of vertex buffers recorded
+        size_t clears{ 0 };     //!< Number of times recorded data was dropped
+    };
+
+    MAYAUSD_CORE_PUBLIC
+    HdVP2PlaybackCache(size_t budgetInBytes);
+    ~HdVP2PlaybackCache() = default;
+
+    MAYAUSD_CORE_PUBLIC
+    const void* Find(const SdfPath& rprimId, const TfToken& bufferName, UsdTimeCode time,
+        size_t sizeInBytes);
+    MAYAUSD_CORE_PUBLIC
+    void Store(const SdfPath& rprimId, const TfToken& bufferName, UsdTimeCode time,
+        std::vector<uint8_t>&& bufferData);
+
+    MAYAUSD_CORE_PUBLIC
+    void Clear();
+
+    MAYAUSD_CORE_PUBLIC
+    void SetActive(bool active);
+
+    //! Whether frame data is recorded and fetched, i.e. whether playback is running
+    bool IsActive() const { return _active; }
+
+    //! Whether Store() records frame data, i.e. playback is running and the budget isn't reached
+    bool IsRecording() const { return _active && !_budgetReached; }
+
+    //! Memory used by the recorded frame data
+    size_t GetMemoryUsage() const { return _memoryUsage; }
+
+    //! Counters summed over all the playback caches of the process, for profiling and tests
+    MAYAUSD_CORE_PUBLIC
+    static Stats GetGlobalStats();
+    MAYAUSD_CORE_PUBLIC
+    static void ResetGlobalStats();
+
+private:
+    HdVP2PlaybackCache(const HdVP2PlaybackCache&) = delete;
+    HdVP2PlaybackCache& operator=(const HdVP2PlaybackCache&) = delete;
+
+    //! Key identifying a vertex buffer of an rprim at a given time
+    using _Key = std::tuple<SdfPath, TfToken, double>;
+
+    struct _KeyHash
+    {
+        size_t operator()(const _Key& key) const {
+            return SdfPath::Hash()(std::get<0>(key)) ^ std::get<1>(key).Hash() ^
+                std::hash<double>()(std::get<2>(key));
+        }
+    };
+
+    using _EntryMap = std::unordered_map<_Key, std::vector<uint8_t>, _KeyHash>;
+
+    const size_t        _budget;                    //!< Maximum memory used by the recorded frame data
+
+    tbb::spin_rw_mutex  _mutex;                     //!< Synchronization of concurrent Sync calls
+    _EntryMap           _entries;                   //!< Recorded vertex buffer data
+    std::atomic<size_t> _memoryUsage{ 0 };
+    std::atomic<bool>   _budgetReached{ false };
+
+    bool                _active{ false };           //!< Written on main thread only
+
+    std::atomic<size_t> _hits{ 0 };
+    std::atomic<size_t> _misses{ 0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -0,0 +1,426 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "primvarPrefetcher.h"
+
+#include <maya/MProfiler.h>
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/tf/debug.h>
+#include <pxr/imaging/hd/tokens.h>
+#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdGeom/primvarsAPI.h>
+#include <pxr/usd/usdSkel/bindingAPI.h>
+#include <pxr/usdImaging/usdImaging/delegate.h>
+#include <pxr/usdImaging/usdImaging/tokens.h>
+
+#include "debugCodes.h"
+#include "render_delegate.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace
+{
+    //! Tolerance used to match the time of a prefetched frame
+    constexpr double kTimeTolerance = 1e-6;
+
+    //! Counters summed over all the prefetchers
+    std::atomic<size_t> globalHits{ 0 };
+    std::atomic<size_t> globalMisses{ 0 };
+    std::atomic<size_t> globalFrames{ 0 };
+    std::atomic<size_t> globalCancellations{ 0 };
+}
+
+/*! \brief  Constructor, allocates the ring buffer for the given number of look-ahead frames.
+*/
+HdVP2PrimvarPrefetcher::HdVP2PrimvarPrefetcher(
+    const UsdStageRefPtr& stage,
+    const UsdImagingDelegate& sceneDelegate,
+    size_t lookAheadFrames)
+    : _stage(stage)
+    , _sceneDelegate(sceneDelegate)
+{
+    _slots.reserve(lookAheadFrames);
+    for (size_t i = 0; i < lookAheadFrames; i++) {
+        _slots.emplace_back(new _FrameSlot);
+    }
+
+    TfWeakPtr<HdVP2PrimvarPrefetcher> me(this);
+    _objectsChangedNoticeKey = TfNotice::Register(
+        me, &HdVP2PrimvarPrefetcher::_OnObjectsChanged, UsdStageWeakPtr(_stage));
+}
+
+/*! \brief  Destructor, waits for worker threads to finish.
+*/
+HdVP2PrimvarPrefetcher::~HdVP2PrimvarPrefetcher()
+{
+    TfNotice::Revoke(_objectsChangedNoticeKey);
+
+    _cancelled = true;
+    _dispatcher.Wait();
+}
+
+/*! \brief  Register a time-varying primvar of an rprim for prefetching. Call is thread safe.
+
+    Primvars which can't be read directly from a USD attribute are ignored.
+*/
+void HdVP2PrimvarPrefetcher::Register(const SdfPath& rprimId, const TfToken& primvarName)
+{
+    _Key key(rprimId, primvarName);
+
+    {
+        std::lock_guard<std::mutex> lock(_sourcesMutex);
+        if (_sources.find(key) != _sources.end()) {
+            return;
+        }
+    }
+
+    // Resolve outside of the lock, concurrent Sync calls can do it in parallel.
+    // An invalid attribute is recorded too so that it's not resolved again.
+    UsdAttribute attribute = _ResolveAttribute(rprimId, primvarName);
+
+    std::lock_guard<std::mutex> lock(_sourcesMutex);
+    auto result = _sources.emplace(std::move(key), std::move(attribute));
+    if (result.second && result.first->second) {
+        _sourcesChanged = true;
+    }
+}
+
+/*! \brief  Get the prefetched value of a primvar. Call is thread safe.
+
+    \return True if the value for the requested time was found in the buffer.
+*/
+bool HdVP2PrimvarPrefetcher::Consume(
+    const SdfPath& rprimId,
+    const TfToken& primvarName,
+    UsdTimeCode time,
+    VtValue* value)
+{
+    if (time.IsDefault()) {
+        return false;
+    }
+
+    const _Key key(rprimId, primvarName);
+
+    for (const auto& slot : _slots) {
+        if (!slot->inUse || !slot->ready ||
+            !GfIsClose(slot->time, time.GetValue(), kTimeTolerance)) {
+            continue;
+        }
+
+        const auto it = slot->values.find(key);
+        if (it != slot->values.end()) {
+            *value = it->second;
+            _hits++;
+            globalHits++;
+            return true;
+        }
+        break;
+    }
+
+    // Only count misses for registered primvars, others are never prefetched.
+    if (_hasLastTime) {
+        std::lock_guard<std::mutex> lock(_sourcesMutex);
+        const auto it = _sources.find(key);
+        if (it != _sources.end() && it->second) {
+            _misses++;
+            globalMisses++;
+        }
+    }
+
+    return false;
+}
+
+/*! \brief  Schedule prefetching of the frames following the given time. Call on main thread before
+            each Sync of the render delegate, and call Wait() once Sync is done.
+
+    \param  time    The time which is about to be drawn
+    \param  playing Whether Maya is playing back animation
+*/
+void HdVP2PrimvarPrefetcher::Update(UsdTimeCode time, bool playing)
+{
+    if (!playing || time.IsDefault() || _slots.empty()) {
+        if (_hasLastTime) {
+            TF_DEBUG(HDVP2_DEBUG_PREFETCH).Msg(
+                "Prefetch stopped: %zu hits, %zu misses (%.1f%% hit rate), %zu frames, "
+                "%zu cancellations\n",
+                _hits.load(), _misses.load(), GetStats().HitRate() * 100.0,
+                _frames.load(), _cancellations);
+        }
+        Cancel();
+        _hasLastTime = false;
+        return;
+    }
+
+    const double currentTime = time.GetValue();
+
+    // The step between frames must be regular for the prefetched frames to be
+    // useful. A different step means scrubbing or a change of direction.
+    if (_stageChanged) {
+        Cancel();
+        _stageChanged = false;
+    }
+    else if (_hasLastTime) {
+        const double timeStep = currentTime - _lastTime;
+        if (timeStep == 0.0) {
+            return;
+        }
+
+        if (!GfIsClose(timeStep, _timeStep, kTimeTolerance)) {
+            Cancel();
+            _timeStep = timeStep;
+        }
+    }
+
+    const bool hadLastTime = _hasLastTime;
+    _lastTime = currentTime;
+    _hasLastTime = true;
+
+    // Need two updates to know the time step.
+    if (!hadLastTime) {
+        return;
+    }
+
+    // Release the frames which were consumed or skipped. The frame of the
+    // current time is kept for the upcoming Sync.
+    for (const auto& slot : _slots) {
+        if (slot->inUse && slot->ready &&
+            (slot->time - currentTime) * _timeStep < -kTimeTolerance) {
+            slot->values.clear();
+            slot->ready = false;
+            slot->inUse = false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_sourcesMutex);
+        if (_sourcesChanged || !_sourcesSnapshot) {
+            auto sources = std::make_shared<std::vector<_Source>>();
+            sources->reserve(_sources.size());
+            for (const auto& entry : _sources) {
+                if (entry.second) {
+                    sources->push_back({ entry.first, entry.second });
+                }
+            }
+            _sourcesSnapshot = sources;
+            _sourcesChanged = false;
+        }
+    }
+
+    if (_sourcesSnapshot->empty()) {
+        return;
+    }
+
+    // Fill free slots with the closest upcoming frames not buffered yet.
+    for (size_t i = 1; i <= _slots.size(); i++) {
+        const double frameTime = currentTime + _timeStep * i;
+
+        bool buffered = false;
+        _FrameSlot* freeSlot = nullptr;
+        for (const auto& slot : _slots) {
+            if (!slot->inUse) {
+                if (!freeSlot) {
+                    freeSlot = slot.get();
+                }
+            }
+            else if (GfIsClose(slot->time, frameTime, kTimeTolerance)) {
+                buffered = true;
+                break;
+            }
+        }
+
+        if (buffered) {
+            continue;
+        }
+        if (!freeSlot) {
+            break;
+        }
+
+        freeSlot->time = frameTime;
+        freeSlot->inUse = true;
+        freeSlot->ready = false;
+
+        auto sources = _sourcesSnapshot;
+        _dispatcher.Run([this, freeSlot, sources]() {
+            _ResolveFrame(freeSlot, sources);
+        });
+    }
+}
+
+/*! \brief  Wait for worker threads to resolve the frames dispatched by Update(). Call on main
+            thread before the update of the render delegate returns.
+*/
+void HdVP2PrimvarPrefetcher::Wait()
+{
+    MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2, "HdVP2PrimvarPrefetcher::Wait");
+
+    _dispatcher.Wait();
+}
+
+/*! \brief  Stop worker threads and drop all prefetched frames. Call on main thread.
+*/
+void HdVP2PrimvarPrefetcher::Cancel()
+{
+    bool hasFrames = false;
+    for (const auto& slot : _slots) {
+        hasFrames = hasFrames || slot->inUse;
+    }
+
+    if (!hasFrames) {
+        return;
+    }
+
+    MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2, "HdVP2PrimvarPrefetcher::Cancel");
+
+    _cancelled = true;
+    _dispatcher.Wait();
+    _cancelled = false;
+
+    for (const auto& slot : _slots) {
+        slot->values.clear();
+        slot->ready = false;
+        slot->inUse = false;
+    }
+
+    _cancellations++;
+    globalCancellations++;
+}
+
+/*! \brief  Get the counters of the prefetcher.
+*/
+HdVP2PrimvarPrefetcher::Stats HdVP2PrimvarPrefetcher::GetStats() const
+{
+    Stats stats;
+    stats.hits = _hits;
+    stats.misses = _misses;
+    stats.frames = _frames;
+    stats.cancellations = _cancellations;
+    return stats;
+}
+
+/*! \brief  Get the counters summed over all the prefetchers of the process.
+*/
+HdVP2PrimvarPrefetcher::Stats HdVP2PrimvarPrefetcher::GetGlobalStats()
+{
+    Stats stats;
+    stats.hits = globalHits;
+    stats.misses = globalMisses;
+    stats.frames = globalFrames;
+    stats.cancellations = globalCancellations;
+    return stats;
+}
+
+/*! \brief  Reset the counters summed over all the prefetchers of the process.
+*/
+void HdVP2PrimvarPrefetcher::ResetGlobalStats()
+{
+    globalHits = 0;
+    globalMisses = 0;
+    globalFrames = 0;
+    globalCancellations = 0;
+}
+
+/*! \brief  Find the USD attribute holding the values of an rprim primvar.
+
+    Mirrors how UsdImaging reads points and normals of point based prims. Prims bound to a
+    skeleton are skipped because their points are computed by UsdSkelImaging.
+*/
+UsdAttribute HdVP2PrimvarPrefetcher::_ResolveAttribute(
+    const SdfPath& rprimId,
+    const TfToken& primvarName) const
+{
+    const SdfPath cachePath = _sceneDelegate.ConvertIndexPathToCachePath(rprimId);
+    if (!cachePath.IsPrimPath()) {
+        return UsdAttribute();
+    }
+
+    const UsdPrim prim = _stage->GetPrimAtPath(cachePath);
+    const UsdGeomPointBased pointBased(prim);
+    if (!pointBased || prim.HasAPI<UsdSkelBindingAPI>()) {
+        return UsdAttribute();
+    }
+
+    UsdAttribute attribute;
+    if (primvarName == HdTokens->points) {
+        attribute = pointBased.GetPointsAttr();
+    }
+    else if (primvarName == HdTokens->normals) {
+        // Normals primvar has precedence over the normals attribute, but
+        // indexed primvars need to be flattened by UsdImaging.
+        const UsdGeomPrimvar primvar =
+            UsdGeomPrimvarsAPI(prim).GetPrimvar(UsdImagingTokens->primvarsNormals);
+        if (primvar && primvar.HasAuthoredValue()) {
+            if (!primvar.IsIndexed()) {
+                attribute = primvar.GetAttr();
+            }
+        }
+        else {
+            attribute = pointBased.GetNormalsAttr();
+        }
+    }
+
+    if (attribute && attribute.ValueMightBeTimeVarying()) {
+        return attribute;
+    }
+    return UsdAttribute();
+}
+
+/*! \brief  Resolve all registered primvars for the time of a frame slot. Runs on a worker thread.
+*/
+void HdVP2PrimvarPrefetcher::_ResolveFrame(
+    _FrameSlot* slot,
+    std::shared_ptr<const std::vector<_Source>> sources)
+{
+    MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2, "HdVP2PrimvarPrefetcher::ResolveFrame");
+
+    const UsdTimeCode time(slot->time);
+
+    slot->values.reserve(sources->size());
+    for (const _Source& source : *sources) {
+        if (_cancelled) {
+            return;
+        }
+
+        VtValue value;
+        if (source.attribute.Get(&value, time)) {
+            slot->values.emplace(source.key, std::move(value));
+        }
+    }
+
+    _frames++;
+    globalFrames++;
+    slot->ready = true;
+}
+
+/*! \brief  Drop prefetched values when the stage gets edited.
+*/
+void HdVP2PrimvarPrefetcher::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged& notice,
+    const UsdStageWeakPtr& sender)
+{
+    _stageChanged = true;
+
+    // Attributes of resynced prims could have been invalidated.
+    if (!notice.GetResyncedPaths().empty()) {
+        std::lock_guard<std::mutex> lock(_sourcesMutex);
+        _sources.clear();
+        _sourcesChanged = true;
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
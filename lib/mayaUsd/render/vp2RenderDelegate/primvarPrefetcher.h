@@ -0,0 +1,168 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_PRIMVAR_PREFETCHER
+#define HD_VP2_PRIMVAR_PREFETCHER
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/work/dispatcher.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <mayaUsd/base/api.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class UsdImagingDelegate;
+
+/*! \brief  Resolves time-varying primvars of upcoming frames on worker threads during playback.
+    \class  HdVP2PrimvarPrefetcher
+
+    Rprims register the primvars they pull at every frame of playback (see Register()). Before
+    each Sync, Update() dispatches value resolution of the registered primvars for the next
+    frames into a ring buffer with a fixed number of frame slots, so that worker threads resolve
+    upcoming frames while the current one is synced. During Sync, rprims query the buffer with
+    Consume() before falling back to the scene delegate.
+
+    Wait() must be called before the update of the render delegate returns: once control is back
+    to Maya, DG evaluation, UFE edits or scripts can write to the stage, and USD doesn't allow
+    reading a stage while it's being edited.
+
+    Prefetching is cancelled and the buffered frames are dropped when playback stops, when the
+    time step changes (scrubbing or change of direction) and when the stage is edited.
+
+    Only attributes which UsdImaging reads without further computation are prefetched, i.e.
+    points and normals of meshes which are not bound to a skeleton. Other primvars are always
+    pulled from the scene delegate.
+*/
+class HdVP2PrimvarPrefetcher : public TfWeakBase
+{
+public:
+    //! Counters exposed for profiling the prefetcher
+    struct Stats
+    {
+        size_t hits{ 0 };           //!< Number of primvar values served from the buffer
+        size_t misses{ 0 };         //!< Number of registered primvars not found in the buffer
+        size_t frames{ 0 };         //!< Number of frames resolved on worker threads
+        size_t cancellations{ 0 };  //!< Number of times buffered frames were dropped
+
+        //! Ratio of the primvar values served from the buffer
+        double HitRate() const {
+            const size_t total = hits + misses;
+            return total ? static_cast<double>(hits) / total : 0.0;
+        }
+    };
+
+    HdVP2PrimvarPrefetcher(
+        const UsdStageRefPtr& stage,
+        const UsdImagingDelegate& sceneDelegate,
+        size_t lookAheadFrames);
+    ~HdVP2PrimvarPrefetcher();
+
+    void Register(const SdfPath& rprimId, const TfToken& primvarName);
+    bool Consume(const SdfPath& rprimId, const TfToken& primvarName, UsdTimeCode time, VtValue* value);
+
+    void Update(UsdTimeCode time, bool playing);
+    void Wait();
+    void Cancel();
+
+    //! Whether playback was running during the last update
+    bool IsActive() const { return _hasLastTime; }
+
+    Stats GetStats() const;
+
+    //! Counters summed over all the prefetchers of the process, for profiling and tests
+    MAYAUSD_CORE_PUBLIC
+    static Stats GetGlobalStats();
+    MAYAUSD_CORE_PUBLIC
+    static void ResetGlobalStats();
+
+private:
+    HdVP2PrimvarPrefetcher(const HdVP2PrimvarPrefetcher&) = delete;
+    HdVP2PrimvarPrefetcher& operator=(const HdVP2PrimvarPrefetcher&) = delete;
+
+    //! Key identifying a primvar of an rprim
+    using _Key = std::pair<SdfPath, TfToken>;
+
+    struct _KeyHash
+    {
+        size_t operator()(const _Key& key) const {
+            return SdfPath::Hash()(key.first) ^ key.second.Hash();
+        }
+    };
+
+    //! A registered primvar and the USD attribute holding its values
+    struct _Source
+    {
+        _Key          key;
+        UsdAttribute  attribute;
+    };
+
+    //! A slot of the ring buffer holding the primvar values of one frame
+    struct _FrameSlot
+    {
+        double                                      time{ 0.0 };
+        bool                                        inUse{ false };    //!< Written and read on main thread only
+        std::atomic<bool>                           ready{ false };    //!< Set by the worker thread once values are resolved
+        std::unordered_map<_Key, VtValue, _KeyHash> values;
+    };
+
+    UsdAttribute _ResolveAttribute(const SdfPath& rprimId, const TfToken& primvarName) const;
+    void _ResolveFrame(_FrameSlot* slot, std::shared_ptr<const std::vector<_Source>> sources);
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender);
+
+    const UsdStageRefPtr        _stage;             //!< Stage the primvars are resolved from
+    const UsdImagingDelegate&   _sceneDelegate;     //!< Used to map rprim ids to USD prim paths
+
+    std::vector<std::unique_ptr<_FrameSlot>>   _slots;   //!< Ring buffer of prefetched frames
+
+    std::mutex                                       _sourcesMutex;      //!< Guards registrations from concurrent Sync calls
+    std::unordered_map<_Key, UsdAttribute, _KeyHash> _sources;           //!< Registered primvars
+    bool                                             _sourcesChanged{ false };
+    std::shared_ptr<const std::vector<_Source>>      _sourcesSnapshot;   //!< Registered primvars handed to worker threads
+
+    WorkDispatcher      _dispatcher;                //!< Runs value resolution on worker threads
+    std::atomic<bool>   _cancelled{ false };        //!< Requests worker threads to stop early
+    std::atomic<bool>   _stageChanged{ false };     //!< Set when the stage got edited since the last update
+
+    double  _lastTime{ 0.0 };                       //!< Time of the last update
+    double  _timeStep{ 0.0 };                       //!< Time step between the last two updates
+    bool    _hasLastTime{ false };                  //!< Whether _lastTime is valid
+
+    std::atomic<size_t> _hits{ 0 };
+    std::atomic<size_t> _misses{ 0 };
+    std::atomic<size_t> _frames{ 0 };
+    size_t              _cancellations{ 0 };
+
+    TfNotice::Key       _objectsChangedNoticeKey;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
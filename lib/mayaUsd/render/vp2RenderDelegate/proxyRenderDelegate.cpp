@@ -15,6 +15,9 @@
 //
 #include "proxyRenderDelegate.h"
 
+#include <mutex>
+
+#include <maya/MAnimControl.h>
 #include <maya/MFileIO.h>
 #include <maya/MFnPluginData.h>
 #include <maya/MHWGeometryUtilities.h>
@@ -23,11 +26,16 @@
 #include <maya/MSelectionContext.h>
 
 #include <pxr/base/tf/diagnostic.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/stringUtils.h>
+#include <pxr/base/tf/weakBase.h>
 #include <pxr/usdImaging/usdImaging/delegate.h>
 #include <pxr/usd/kind/registry.h>
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/modelAPI.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/imaging/hdx/renderTask.h>
 #include <pxr/imaging/hdx/selectionTracker.h>
 #include <pxr/imaging/hdx/taskController.h>
@@ -36,17 +44,19 @@
 #include <pxr/imaging/hd/mesh.h>
 #include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/rprimCollection.h>
-#include <pxr/imaging/hd/primGather.h>
 
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/nodes/stageData.h>
 #include <mayaUsd/utils/util.h>
 
+#include "playbackCache.h"
+#include "primvarPrefetcher.h"
 #include "render_delegate.h"
 #include "tokens.h"
 
 #if defined(WANT_UFE_BUILD)
 #include <mayaUsd/ufe/UsdSceneItem.h>
+#include <mayaUsd/ufe/UsdTransform3dEditBatch.h>
 
 #include <ufe/globalSelection.h>
 #include <ufe/observableSelection.h>
@@ -59,6 +69,16 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(MAYAUSD_VP2_PREFETCH_FRAMES, 0,
+    "Number of frames ahead of the current one for which time-varying points "
+    "and normals are resolved on worker threads during playback. Prefetching "
+    "is disabled when zero.");
+
+TF_DEFINE_ENV_SETTING(MAYAUSD_VP2_PLAYBACK_CACHE_MB, 0,
+    "Memory budget in megabytes of the cache recording the vertex buffers of "
+    "animated meshes during playback, so that looped playback doesn't prepare "
+    "them again. The cache is disabled when zero.");
+
 namespace
 {
     //! Representation selector for shaded and textured viewport mode
@@ -123,22 +143,22 @@ namespace
         return TfToken();
     }
 
-    //! \brief  Populate Rprims into the Hydra selection from the UFE scene item.
-    void PopulateSelection(
+    //! \brief  Get the path to populate into the Hydra selection for the UFE scene item.
+    //! \return The path, or an empty path if the item is not a USD item under the proxy shape.
+    SdfPath GetSelectionPath(
         const Ufe::SceneItem::Ptr& item,
         const Ufe::Path& proxyPath,
-        UsdImagingDelegate& sceneDelegate,
-        const HdSelectionSharedPtr& result)
+        UsdImagingDelegate& sceneDelegate)
     {
         // Filter out items which are not under the current proxy shape.
         if (!item->path().startsWith(proxyPath)) {
-            return;
+            return SdfPath();
         }
 
         // Filter out non-USD items.
         auto usdItem = std::dynamic_pointer_cast<MayaUsd::ufe::UsdSceneItem>(item);
         if (!usdItem) {
-            return;
+            return SdfPath();
         }
 
         SdfPath usdPath = usdItem->prim().GetPath();
@@ -147,8 +167,17 @@ namespace
         usdPath = sceneDelegate.ConvertCachePathToIndexPath(usdPath);
 #endif
 
+        return usdPath;
+    }
+
+    //! \brief  Populate Rprims into the Hydra selection from the selected path.
+    void PopulateSelection(
+        const SdfPath& path,
+        UsdImagingDelegate& sceneDelegate,
+        const HdSelectionSharedPtr& result)
+    {
         sceneDelegate.PopulateSelection(HdSelection::HighlightModeSelect,
-            usdPath, UsdImagingDelegate::ALL_INSTANCES, result);
+            path, UsdImagingDelegate::ALL_INSTANCES, result);
     }
 #endif // defined(WANT_UFE_BUILD)
 
@@ -250,62 +279,6 @@ namespace
     }
 #endif
 
-// Copied from renderIndex.cpp, the code that does HdRenderIndex::GetDrawItems. But I just want the rprimIds, I don't want to go all the way to draw items.
-struct _FilterParam {
-    const HdRprimCollection& collection;
-    const TfTokenVector&     renderTags;
-    const HdRenderIndex*     renderIndex;
-};
-
-bool _DrawItemFilterPredicate(const SdfPath& rprimID, const void* predicateParam)
-{
-    const _FilterParam* filterParam = static_cast<const _FilterParam*>(predicateParam);
-
-    const HdRprimCollection& collection = filterParam->collection;
-    const TfTokenVector&     renderTags = filterParam->renderTags;
-    const HdRenderIndex*     renderIndex = filterParam->renderIndex;
-
-    //
-    // Render Tag Filter
-    //
-    bool passedRenderTagFilter = false;
-    if (renderTags.empty()) {
-        // An empty render tag set means everything passes the filter
-        // Primary user is tests, but some single task render delegates
-        // that don't support render tags yet also use it.
-        passedRenderTagFilter = true;
-    } else {
-        // As the number of tags is expected to be low (<10)
-        // use a simple linear search.
-        TfToken primRenderTag = renderIndex->GetRenderTag(rprimID);
-        size_t  numRenderTags = renderTags.size();
-        size_t  tagNum = 0;
-        while (!passedRenderTagFilter && tagNum < numRenderTags) {
-            if (renderTags[tagNum] == primRenderTag) {
-                passedRenderTagFilter = true;
-            }
-            ++tagNum;
-        }
-    }
-
-    //
-    // Material Tag Filter
-    //
-    bool passedMaterialTagFilter = false;
-
-    // Filter out rprims that do not match the collection's materialTag.
-    // E.g. We may want to gather only opaque or translucent prims.
-    // An empty materialTag on collection means: ignore material-tags.
-    // This is important for tasks such as the selection-task which wants
-    // to ignore materialTags and receive all prims in its collection.
-    TfToken const& collectionMatTag = collection.GetMaterialTag();
-    if (collectionMatTag.IsEmpty() || renderIndex->GetMaterialTag(rprimID) == collectionMatTag) {
-        passedMaterialTagFilter = true;
-    }
-
-    return (passedRenderTagFilter && passedMaterialTagFilter);
-}
-
 } // namespace
 
 //! \brief  Draw classification used during plugin load to register in VP2
@@ -329,6 +302,78 @@ ProxyRenderDelegate::ProxyRenderDelegate(const MObject& obj)
     _proxyShapeData.reset(new ProxyShapeData(static_cast<MayaUsdProxyShapeBase*>(fnDepNode.userNode()), proxyDagPath));
 }
 
+/*! \brief  Collect the prims whose purpose changed on the stage.
+
+    Purpose edits are the only scene changes which change render tags. The
+    rprims whose render tag changed are found under these prims, instead of
+    checking the dirty bits of every rprim of the render index.
+*/
+class ProxyRenderDelegate::_PurposeListener : public TfWeakBase
+{
+public:
+    _PurposeListener(const UsdStageRefPtr& stage)
+    {
+        TfWeakPtr<_PurposeListener> me(this);
+        _objectsChangedNoticeKey = TfNotice::Register(
+            me, &_PurposeListener::_OnObjectsChanged, UsdStageWeakPtr(stage));
+    }
+
+    ~_PurposeListener()
+    {
+        TfNotice::Revoke(_objectsChangedNoticeKey);
+    }
+
+    /*! \brief  Move the paths of the prims whose purpose changed since the last call to paths.
+
+        Return false if the rprims of a change can't be found under the changed prim, which
+        happens with native instancing since prototype rprims are shared by instances.
+    */
+    bool TakeChangedPaths(SdfPathVector* paths)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        paths->swap(_changedPaths);
+        _changedPaths.clear();
+        const bool located = !_unlocatedChange;
+        _unlocatedChange = false;
+        return located;
+    }
+
+private:
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // Resynced prims may change purpose, and so do purpose attribute edits.
+        auto addPath = [this](const SdfPath& path) {
+            if (path.IsPrimPath() || path.IsAbsoluteRootPath()) {
+                _changedPaths.push_back(path);
+            }
+            else if (path.IsPropertyPath() && path.GetNameToken() == UsdGeomTokens->purpose) {
+                _changedPaths.push_back(path.GetPrimPath());
+            }
+        };
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            addPath(path);
+        }
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+            addPath(path);
+        }
+
+        if (!_changedPaths.empty() && sender) {
+#if USD_VERSION_NUM > 2008
+            _unlocatedChange |= !sender->GetPrototypes().empty();
+#else
+            _unlocatedChange |= !sender->GetMasters().empty();
+#endif
+        }
+    }
+
+    TfNotice::Key _objectsChangedNoticeKey;
+    std::mutex    _mutex;
+    SdfPathVector _changedPaths;
+    bool          _unlocatedChange { false };
+};
+
 //! \brief  Destructor
 ProxyRenderDelegate::~ProxyRenderDelegate() {
     _ClearRenderDelegate();
@@ -361,6 +406,18 @@ void ProxyRenderDelegate::_ClearRenderDelegate()
 {
     // The order of deletion matters. Some orders cause crashes.
 
+    _primvarPrefetcher.reset();
+    _playbackCache.reset();
+    _purposeListener.reset();
+
+    // The selection will be populated again with the new scene delegate.
+    _leadSelection.reset();
+    _activeSelection.reset();
+    _selectionStatus.clear();
+    _selectionChanged = true;
+    _selectionRprimIndexVersion = 0;
+    _selectionRprimsChanged = false;
+
     _sceneDelegate.reset();
     _taskController.reset();
     _renderIndex.reset();
@@ -380,6 +437,12 @@ void ProxyRenderDelegate::_InitRenderDelegate(MSubSceneContainer& container) {
         _dummyTasks.clear();
         container.clear();
 
+        _rprimIndexVersion = 0;
+        _renderTagRprims.clear();
+        _rprimRenderTags.clear();
+        _renderTagChangedRprims.clear();
+        _taskRenderTagsValid = false;
+
         _proxyShapeData->UpdateUsdStage();
     }
     
@@ -424,6 +487,21 @@ void ProxyRenderDelegate::_InitRenderDelegate(MSubSceneContainer& container) {
 
         _sceneDelegate.reset(new UsdImagingDelegate(_renderIndex.get(), delegateID));
 
+        const int prefetchFrames = TfGetEnvSetting(MAYAUSD_VP2_PREFETCH_FRAMES);
+        if (prefetchFrames > 0 && _proxyShapeData->UsdStage()) {
+            _primvarPrefetcher.reset(new HdVP2PrimvarPrefetcher(
+                _proxyShapeData->UsdStage(), *_sceneDelegate, prefetchFrames));
+        }
+
+        if (_proxyShapeData->UsdStage()) {
+            _purposeListener.reset(new _PurposeListener(_proxyShapeData->UsdStage()));
+        }
+
+        const int playbackCacheMB = TfGetEnvSetting(MAYAUSD_VP2_PLAYBACK_CACHE_MB);
+        if (playbackCacheMB > 0) {
+            _playbackCache.reset(new HdVP2PlaybackCache(size_t(playbackCacheMB) << 20));
+        }
+
         _taskController.reset(new HdxTaskController(_renderIndex.get(),
             delegateID.AppendChild(TfToken(TfStringPrintf("_UsdImaging_VP2_%p", this))) ));
 
@@ -502,6 +580,22 @@ void ProxyRenderDelegate::_UpdateSceneDelegate()
     MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorC_L1, "UpdateSceneDelegate");
 
+    // Frame data recorded for playback is stale after any stage edit. Edits
+    // are applied separately from the time change so that the change tracker
+    // tells them apart from the time-varying updates.
+    if (_playbackCache) {
+        HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+        const unsigned int sceneStateVersion = changeTracker.GetSceneStateVersion();
+
+        _sceneDelegate->ApplyPendingUpdates();
+
+        if (changeTracker.GetSceneStateVersion() != sceneStateVersion) {
+            _playbackCache->Clear();
+        }
+
+        _playbackCache->SetActive(MAnimControl::isPlaying());
+    }
+
     {
         MProfilingScope subProfilingScope(HdVP2RenderDelegate::sProfilerCategory,
             MProfiler::kColorC_L1, "SetTime");
@@ -583,6 +677,16 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
         }
     }
     else {
+        // Rprims inserted under selected paths are missing from the
+        // selection, rebuild it from scratch.
+        const unsigned int rprimIndexVersion =
+            _renderIndex->GetChangeTracker().GetRprimIndexVersion();
+        if (_selectionRprimIndexVersion != rprimIndexVersion) {
+            _selectionRprimIndexVersion = rprimIndexVersion;
+            _selectionRprimsChanged = true;
+            _selectionChanged = true;
+        }
+
         if (_selectionChanged) {
             _UpdateSelectionStates();
             _selectionChanged = false;
@@ -626,6 +730,12 @@ void ProxyRenderDelegate::_Execute(const MHWRender::MFrameContext& frameContext)
         _taskController->SetCollection(*_defaultCollection);
     }
 
+    // Render tag changes are synced with the repr of regular draws, so defer
+    // them while the repr selector is the one of a selection pass.
+    if (!inSelectionPass) {
+        _SyncRenderTagChanges(reprSelector);
+    }
+
     _engine.Execute(_renderIndex.get(), &_dummyTasks);
 }
 
@@ -634,6 +744,13 @@ void ProxyRenderDelegate::update(MSubSceneContainer& container, const MFrameCont
     MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
         MProfiler::kColorD_L1, "ProxyRenderDelegate::update");
 
+#if defined(WANT_UFE_BUILD)
+    // A viewport refresh ends a manipulation tick. Author the transform values
+    // queued by the commands of all the manipulated items together, before the
+    // scene delegate applies the stage changes.
+    MayaUsd::ufe::UsdTransform3dEditBatch::flush();
+#endif
+
     _InitRenderDelegate(container);
 
     // Give access to current time and subscene container to the rest of render delegate world via render param's.
@@ -642,7 +759,19 @@ void ProxyRenderDelegate::update(MSubSceneContainer& container, const MFrameCont
 
     if (_Populate()) {
         _UpdateSceneDelegate();
+
+        // Start resolving the next frames while this one is synced. Worker
+        // threads must be done before returning to Maya, which can then write
+        // to the stage.
+        if (_primvarPrefetcher) {
+            _primvarPrefetcher->Update(_sceneDelegate->GetTime(), MAnimControl::isPlaying());
+        }
+
         _Execute(frameContext);
+
+        if (_primvarPrefetcher) {
+            _primvarPrefetcher->Wait();
+        }
     }
     param->EndUpdate();
 }
@@ -793,31 +922,127 @@ void ProxyRenderDelegate::SelectionChanged()
     _selectionChanged = true;
 }
 
-//! \brief  Polulate lead and active selection for Rprims under the proxy shape.
-void ProxyRenderDelegate::_PopulateSelection()
+/*! \brief  Populate lead and active selection for Rprims under the proxy shape.
+
+    The selection status of each selected path is kept between updates, so that only the
+    paths whose status changed are populated. The Rprims of these paths are appended to
+    changedRprims, when not null. When Rprims were inserted or removed, the lead and active
+    selections are rebuilt and the Rprims of both the previous and the new selections are
+    appended instead.
+*/
+void ProxyRenderDelegate::_PopulateSelection(SdfPathVector* changedRprims)
 {
 #if defined(WANT_UFE_BUILD)
     if (_proxyShapeData->ProxyShape() == nullptr) {
         return;
     }
 
-    _leadSelection.reset(new HdSelection);
-    _activeSelection.reset(new HdSelection);
-
     const auto proxyPath = _proxyShapeData->ProxyShape()->ufePath();
     const auto globalSelection = Ufe::GlobalSelection::get();
 
-    // Populate lead selection from the last item in UFE global selection.
-    auto it = globalSelection->crbegin();
-    if (it != globalSelection->crend()) {
-        PopulateSelection(*it, proxyPath, *_sceneDelegate, _leadSelection);
+    // The last item in UFE global selection is the lead selection, the other
+    // items are the active selection.
+    std::unordered_map<SdfPath, MHWRender::DisplayStatus, SdfPath::Hash> selectionStatus;
+    for (auto it = globalSelection->crbegin(); it != globalSelection->crend(); it++) {
+        const SdfPath path = GetSelectionPath(*it, proxyPath, *_sceneDelegate);
+        if (!path.IsEmpty()) {
+            selectionStatus.emplace(path,
+                (it == globalSelection->crbegin()) ? MHWRender::kLead : MHWRender::kActive);
+        }
+    }
+
+    // Find the paths whose status changed.
+    SdfPathVector changedPaths;
+    SdfPathVector addedActivePaths;
+    bool leadChanged = false;
+    bool activeRemoved = false;
+
+    for (const auto& entry : _selectionStatus) {
+        const auto found = selectionStatus.find(entry.first);
+        if (found == selectionStatus.end() || found->second != entry.second) {
+            changedPaths.push_back(entry.first);
+            leadChanged |= (entry.second == MHWRender::kLead);
+            activeRemoved |= (entry.second == MHWRender::kActive);
+        }
+    }
+
+    for (const auto& entry : selectionStatus) {
+        const auto found = _selectionStatus.find(entry.first);
+        if (found == _selectionStatus.end() || found->second != entry.second) {
+            if (found == _selectionStatus.end()) {
+                changedPaths.push_back(entry.first);
+            }
+            leadChanged |= (entry.second == MHWRender::kLead);
+            if (entry.second == MHWRender::kActive) {
+                addedActivePaths.push_back(entry.first);
+            }
+        }
+    }
+
+    _selectionStatus.swap(selectionStatus);
+
+    // After Rprims were inserted or removed, the kept status doesn't tell which Rprims are
+    // selected anymore: rebuild both selections, and update the Rprims of the previous and the
+    // new selections.
+    if (_selectionRprimsChanged || !_leadSelection || !_activeSelection) {
+        _selectionRprimsChanged = false;
+
+        if (changedRprims) {
+            AppendSelectedPrimPaths(_leadSelection, *changedRprims);
+            AppendSelectedPrimPaths(_activeSelection, *changedRprims);
+        }
+
+        _leadSelection.reset(new HdSelection);
+        _activeSelection.reset(new HdSelection);
+        for (const auto& entry : _selectionStatus) {
+            PopulateSelection(entry.first, *_sceneDelegate,
+                (entry.second == MHWRender::kLead) ? _leadSelection : _activeSelection);
+        }
+
+        if (changedRprims) {
+            AppendSelectedPrimPaths(_leadSelection, *changedRprims);
+            AppendSelectedPrimPaths(_activeSelection, *changedRprims);
+        }
+        return;
+    }
+
+    if (changedPaths.empty()) {
+        return;
+    }
 
-        // Start reverse iteration from the second last item in UFE global
-        // selection and populate active selection.
-        for (it++; it != globalSelection->crend(); it++) {
-            PopulateSelection(*it, proxyPath, *_sceneDelegate, _activeSelection);
+    // Hydra selections can't remove paths, rebuild them when paths were
+    // removed. Otherwise append the added paths.
+    if (leadChanged) {
+        _leadSelection.reset(new HdSelection);
+        for (const auto& entry : _selectionStatus) {
+            if (entry.second == MHWRender::kLead) {
+                PopulateSelection(entry.first, *_sceneDelegate, _leadSelection);
+            }
         }
     }
+
+    if (activeRemoved) {
+        _activeSelection.reset(new HdSelection);
+        for (const auto& entry : _selectionStatus) {
+            if (entry.second == MHWRender::kActive) {
+                PopulateSelection(entry.first, *_sceneDelegate, _activeSelection);
+            }
+        }
+    }
+    else {
+        for (const SdfPath& path : addedActivePaths) {
+            PopulateSelection(path, *_sceneDelegate, _activeSelection);
+        }
+    }
+
+    // Only Rprims of the changed paths need to update their selection status.
+    if (changedRprims && !changedPaths.empty()) {
+        HdSelectionSharedPtr changedSelection(new HdSelection);
+        for (const SdfPath& path : changedPaths) {
+            PopulateSelection(path, *_sceneDelegate, changedSelection);
+        }
+        AppendSelectedPrimPaths(changedSelection, *changedRprims);
+    }
 #endif
 }
 
@@ -837,19 +1062,12 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
     }
     else if (previousStatus == MHWRender::kLead || previousStatus == MHWRender::kActive) {
         rootPaths.push_back(SdfPath::AbsoluteRootPath());
-        _PopulateSelection();
+        _PopulateSelection(nullptr);
     }
     else {
-        // Append pre-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
-
-        // Update lead and active selection.
-        _PopulateSelection();
-
-        // Append post-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        // Update lead and active selection, and append the Rprims whose
+        // selection status changed.
+        _PopulateSelection(&rootPaths);
     }
 
     if (!rootPaths.empty()) {
@@ -861,7 +1079,7 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
     }
 }
 
-/*! \brief  Trigger rprim update for rprims whose visibility changed because of render tags change
+/*! \brief  Find the rprims whose visibility changed because of render tags change
 */
 void ProxyRenderDelegate::_UpdateRenderTags()
 {
@@ -878,19 +1096,24 @@ void ProxyRenderDelegate::_UpdateRenderTags()
     // which means we do need to update individual MRenderItems when the displayed
     // render tags change, or when the render tag on an rprim changes.
     //
-    // To handle an rprim's render tag value changing we need to be sure that
-    // the dummy render task we use to draw includes all render tags. If we
-    // leave any tags out then when an rprim changes from a visible tag to
-    // a hidden one that rprim will get marked dirty, but Sync will not be
-    // called because the rprim doesn't match the current render tags.
+    // When an rprim changes from a visible tag to a hidden one, that rprim gets
+    // marked dirty but Sync will not be called because the rprim doesn't match
+    // the current render tags. Rather than switching the dummy render task to
+    // all render tags, which would visit every rprim of the render index, we
+    // collect the ids of the rprims whose render tag or visibility changed and
+    // sync only those with all render tags in _SyncRenderTagChanges().
     //
     // When we change the desired render tags on the proxyShape we'll be adding
     // and/or removing some tags, so we can have existing MRenderItems that need
-    // to be hidden, or hidden items that need to be shown. To do that we need
-    // to make sure every rprim with a render tag whose visibility changed gets
-    // marked dirty. This will ensure the upcoming execute call will update
-    // the visibility of the MRenderItems in MPxSubSceneOverride.
+    // to be hidden, or hidden items that need to be shown. Those rprims are
+    // found through the per-render-tag rprim index.
     HdChangeTracker& changeTracker = _renderIndex->GetChangeTracker();
+
+    const bool rprimIndexChanged = (_rprimIndexVersion != changeTracker.GetRprimIndexVersion());
+    if (rprimIndexChanged) {
+        _UpdateRenderTagIndex();
+    }
+
     bool renderPurposeChanged = false;
     bool proxyPurposeChanged = false;
     bool guidePurposeChanged = false;
@@ -902,7 +1125,6 @@ void ProxyRenderDelegate::_UpdateRenderTags()
             MProfiler::kColorD_L1, "Update Purpose");
 
         // Build the list of render tags which were added or removed (changed)
-        // and the list of render tags which were removed.
         TfTokenVector changedRenderTags;
         if (renderPurposeChanged) {
             changedRenderTags.push_back(HdRenderTagTokens->render);
@@ -915,11 +1137,20 @@ void ProxyRenderDelegate::_UpdateRenderTags()
         }
 
         // Mark all the rprims which have a render tag which changed dirty
-        SdfPathVector    rprimsToDirty = _GetFilteredRprims(*_defaultCollection, changedRenderTags);
-        
-        for (auto& id : rprimsToDirty) {
-            changeTracker.MarkRprimDirty(id, HdChangeTracker::DirtyRenderTag);
+        for (const TfToken& renderTag : changedRenderTags) {
+            const auto it = _renderTagRprims.find(renderTag);
+            if (it == _renderTagRprims.end()) {
+                continue;
+            }
+
+            for (const SdfPath& id : it->second) {
+                changeTracker.MarkRprimDirty(id, HdChangeTracker::DirtyRenderTag);
+                _renderTagChangedRprims.insert(id);
+            }
         }
+
+        // The drawn render tags changed, so the task needs the new minimum set.
+        _taskRenderTagsValid = false;
     }
 
     // The renderTagsVersion increments when the render tags on an rprim changes, or when the
@@ -931,60 +1162,174 @@ void ProxyRenderDelegate::_UpdateRenderTags()
     rprimRenderTagChanged = rprimRenderTagChanged || ( _visibilityVersion != changeTracker.GetVisibilityChangeCount());
 #endif
 
-    // Vp2RenderDelegate implements render tags as a per-render item setting.
-    // To handle cases when an rprim changes from a displayed tag to a hidden tag
-    // we need to visit all the rprims and set the enable flag correctly on
-    // all their render items. Do visit all the rprims we need to set the 
-    // render tags to be all the tags.
-    // When an rprim has it's renderTag changed the global render tag version
-    // id will change.
-    if (rprimRenderTagChanged)
+    // Purpose edits are the only scene changes which change render tags, the
+    // changed prims are taken on every update so that they don't pile up.
+    SdfPathVector purposeChangedPaths;
+    const bool purposeChangesLocated = _purposeListener
+        && _purposeListener->TakeChangedPaths(&purposeChangedPaths);
+
+    // Only the rprims which are dirty for render tag or visibility can have
+    // render items that need to be enabled or disabled. Checking dirty bits is
+    // much cheaper than syncing, and those rprims are the only ones that need
+    // to be synced with all render tags. Rprims which stay in a drawn render
+    // tag are synced anyway, so only the rprims under prims whose purpose
+    // changed are checked, unless the changes can't be located.
+    if (rprimRenderTagChanged || rprimIndexChanged)
     {
-        TfTokenVector renderTags = { HdRenderTagTokens->geometry,
-                                     HdRenderTagTokens->render,
-                                     HdRenderTagTokens->proxy,
-                                     HdRenderTagTokens->guide };
-        _taskController->SetRenderTags(renderTags);
-        _taskRenderTagsValid = false;
-    }
-    // When the render tag on an rprim changes we do a pass over all rprims to update
-    // their visibility. The frame after we do the pass over all the tags, set the tags back to
-    // the minimum set of tags.
-    else if (!_taskRenderTagsValid) {
-        TfTokenVector renderTags = { HdRenderTagTokens->geometry }; // always draw geometry render tag purpose.
-        if (_proxyShapeData->DrawRenderPurpose()) {
-            renderTags.push_back(HdRenderTagTokens->render);
-        }
-        if (_proxyShapeData->DrawProxyPurpose()) {
-            renderTags.push_back(HdRenderTagTokens->proxy);
+        MProfilingScope subProfilingScope(HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorD_L1, "Find Render Tag Changes");
+
+        constexpr HdDirtyBits renderTagDirtyBits = HdChangeTracker::DirtyRenderTag
+#ifdef ENABLE_RENDERTAG_VISIBILITY_WORKAROUND
+            | HdChangeTracker::DirtyVisibility
+#endif
+            ;
+
+        if (rprimIndexChanged || !purposeChangesLocated) {
+            for (const auto& entry : _rprimRenderTags) {
+                if (changeTracker.GetRprimDirtyBits(entry.first) & renderTagDirtyBits) {
+                    _renderTagChangedRprims.insert(entry.first);
+                }
+            }
         }
-        if (_proxyShapeData->DrawGuidePurpose()) {
-            renderTags.push_back(HdRenderTagTokens->guide);
+        else {
+            for (const SdfPath& path : purposeChangedPaths) {
+                const SdfPath indexPath = _sceneDelegate->ConvertCachePathToIndexPath(path);
+                for (const SdfPath& id : _renderIndex->GetRprimSubtree(indexPath)) {
+                    if (changeTracker.GetRprimDirtyBits(id) & renderTagDirtyBits) {
+                        _renderTagChangedRprims.insert(id);
+                    }
+                }
+            }
         }
-        _taskController->SetRenderTags(renderTags);
-        _taskRenderTagsValid = true;
     }
+
     _renderTagVersion = changeTracker.GetRenderTagVersion();
 #ifdef ENABLE_RENDERTAG_VISIBILITY_WORKAROUND
     _visibilityVersion = changeTracker.GetVisibilityChangeCount();
 #endif
 }
 
-//! \brief  List the rprims in collection that match renderTags
-SdfPathVector ProxyRenderDelegate::_GetFilteredRprims(
-    HdRprimCollection const& collection,
-    TfTokenVector const&     renderTags)
+/*! \brief  Update render items of the rprims whose render tag or visibility changed.
+
+    The changed rprims are synced with all render tags so that rprims which
+    now have a hidden render tag get their render items disabled. The dummy
+    render task is then restored to the minimum set of render tags.
+*/
+void ProxyRenderDelegate::_SyncRenderTagChanges(const HdReprSelector& reprSelector)
 {
-    SdfPathVector rprimIds;
-    const SdfPathVector& paths = _renderIndex->GetRprimIds();
-    const SdfPathVector& includePaths = collection.GetRootPaths();
-    const SdfPathVector& excludePaths = collection.GetExcludePaths();
-    _FilterParam         filterParam = { collection, renderTags, _renderIndex.get() };
-    HdPrimGather         gather;
-    gather.PredicatedFilter(
-        paths, includePaths, excludePaths, _DrawItemFilterPredicate, &filterParam, &rprimIds);
-
-    return rprimIds;
+    if (!_renderTagChangedRprims.empty()) {
+        MProfilingScope subProfilingScope(HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorD_L1, "Sync Render Tag Changes");
+
+        const SdfPathVector rootPaths(
+            _renderTagChangedRprims.begin(), _renderTagChangedRprims.end());
+
+        HdRprimCollection collection(HdTokens->geometry, reprSelector);
+        collection.SetRootPaths(rootPaths);
+        _taskController->SetCollection(collection);
+
+        const TfTokenVector renderTags = { HdRenderTagTokens->geometry,
+                                           HdRenderTagTokens->render,
+                                           HdRenderTagTokens->proxy,
+                                           HdRenderTagTokens->guide };
+        _taskController->SetRenderTags(renderTags);
+
+        _engine.Execute(_renderIndex.get(), &_dummyTasks);
+
+        _taskController->SetCollection(*_defaultCollection);
+        _taskRenderTagsValid = false;
+
+        // The render tags are up to date after the sync, record them so
+        // that purpose toggles find these rprims in the right place.
+        for (const SdfPath& id : rootPaths) {
+            if (_renderIndex->HasRprim(id)) {
+                _SetRprimRenderTag(id, _renderIndex->GetRenderTag(id));
+            }
+        }
+
+        _renderTagChangedRprims.clear();
+    }
+
+    if (!_taskRenderTagsValid) {
+        _taskController->SetRenderTags(_GetDrawnRenderTags());
+        _taskRenderTagsValid = true;
+
+        // Setting the task render tags bumps the render tag version, which
+        // must not be mistaken for an rprim render tag change next update.
+        _renderTagVersion = _renderIndex->GetChangeTracker().GetRenderTagVersion();
+    }
+}
+
+/*! \brief  Update the per-render-tag rprim index after rprims were inserted or removed.
+
+    Rprims which were already indexed keep their last known render tag. New
+    rprims are fully dirty, so they are synced with all render tags and their
+    render tag gets recorded afterwards in _SyncRenderTagChanges().
+*/
+void ProxyRenderDelegate::_UpdateRenderTagIndex()
+{
+    MProfilingScope subProfilingScope(HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L1, "Update Render Tag Index");
+
+    std::unordered_map<SdfPath, TfToken, SdfPath::Hash> previousRenderTags;
+    previousRenderTags.swap(_rprimRenderTags);
+    _renderTagRprims.clear();
+
+    for (const SdfPath& id : _renderIndex->GetRprimIds()) {
+        const auto it = previousRenderTags.find(id);
+        if (it != previousRenderTags.end()) {
+            _SetRprimRenderTag(id, it->second);
+        }
+        else {
+            _SetRprimRenderTag(id, TfToken());
+            _renderTagChangedRprims.insert(id);
+        }
+    }
+
+    // Changes of removed rprims don't need to be synced anymore.
+    for (auto it = _renderTagChangedRprims.begin(); it != _renderTagChangedRprims.end(); ) {
+        if (_rprimRenderTags.count(*it) == 0) {
+            it = _renderTagChangedRprims.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    _rprimIndexVersion = _renderIndex->GetChangeTracker().GetRprimIndexVersion();
+}
+
+//! \brief  Record the render tag of an rprim in the per-render-tag rprim index.
+void ProxyRenderDelegate::_SetRprimRenderTag(const SdfPath& id, const TfToken& renderTag)
+{
+    auto result = _rprimRenderTags.emplace(id, renderTag);
+    if (!result.second) {
+        if (result.first->second == renderTag) {
+            return;
+        }
+
+        _renderTagRprims[result.first->second].erase(id);
+        result.first->second = renderTag;
+    }
+
+    _renderTagRprims[renderTag].insert(id);
+}
+
+//! \brief  List the minimum set of render tags the dummy render task needs to draw.
+TfTokenVector ProxyRenderDelegate::_GetDrawnRenderTags() const
+{
+    TfTokenVector renderTags = { HdRenderTagTokens->geometry }; // always draw geometry render tag purpose.
+    if (_proxyShapeData->DrawRenderPurpose()) {
+        renderTags.push_back(HdRenderTagTokens->render);
+    }
+    if (_proxyShapeData->DrawProxyPurpose()) {
+        renderTags.push_back(HdRenderTagTokens->proxy);
+    }
+    if (_proxyShapeData->DrawGuidePurpose()) {
+        renderTags.push_back(HdRenderTagTokens->guide);
+    }
+    return renderTags;
 }
 
 //! \brief  Query the selection state of a given prim from the lead selection.
@@ -1061,6 +1406,18 @@ bool ProxyRenderDelegate::DrawRenderTag(const TfToken& renderTag) const
     }
 }
 
+//! \brief  Get the look-ahead primvar prefetcher, null if prefetching is disabled.
+HdVP2PrimvarPrefetcher* ProxyRenderDelegate::GetPrimvarPrefetcher() const
+{
+    return _primvarPrefetcher.get();
+}
+
+//! \brief  Get the RAM playback cache, null if the cache is disabled.
+HdVP2PlaybackCache* ProxyRenderDelegate::GetPlaybackCache() const
+{
+    return _playbackCache.get();
+}
+
 // ProxyShapeData
 ProxyRenderDelegate::ProxyShapeData::ProxyShapeData(const MayaUsdProxyShapeBase* proxyShape, const MDagPath& proxyDagPath)
     : _proxyShape(proxyShape)
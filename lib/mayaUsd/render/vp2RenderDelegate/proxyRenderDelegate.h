@@ -17,6 +17,7 @@
 #define PROXY_RENDER_DELEGATE
 
 #include <memory>
+#include <unordered_map>
 
 #include <maya/MDagPath.h>
 #include <maya/MDrawContext.h>
@@ -28,7 +29,9 @@
 #include <maya/MPxSubSceneOverride.h>
 
 #include <pxr/pxr.h>
+#include <pxr/base/tf/token.h>
 #include <pxr/imaging/hd/engine.h>
+#include <pxr/imaging/hd/repr.h>
 #include <pxr/imaging/hd/selection.h>
 #include <pxr/imaging/hd/task.h>
 #include <pxr/usd/sdf/path.h>
@@ -64,6 +67,8 @@ class HdRprimCollection;
 class UsdImagingDelegate;
 class MayaUsdProxyShapeBase;
 class HdxTaskController;
+class HdVP2PlaybackCache;
+class HdVP2PrimvarPrefetcher;
 
 /*! \brief  Enumerations for selection status
 */
@@ -144,6 +149,12 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool DrawRenderTag(const TfToken& renderTag) const;
 
+    MAYAUSD_CORE_PUBLIC
+    HdVP2PrimvarPrefetcher* GetPrimvarPrefetcher() const;
+
+    MAYAUSD_CORE_PUBLIC
+    HdVP2PlaybackCache* GetPlaybackCache() const;
+
 private:
     ProxyRenderDelegate(const ProxyRenderDelegate&) = delete;
     ProxyRenderDelegate& operator=(const ProxyRenderDelegate&) = delete;
@@ -156,10 +167,15 @@ private:
 
     bool _isInitialized();
 
-    void _PopulateSelection();
+    void _PopulateSelection(SdfPathVector* changedRprims);
     void _UpdateSelectionStates();
     void _UpdateRenderTags();
-    SdfPathVector _GetFilteredRprims(HdRprimCollection const& collection, TfTokenVector const& renderTags);
+    void _UpdateRenderTagIndex();
+    void _SetRprimRenderTag(const SdfPath& id, const TfToken& renderTag);
+    void _SyncRenderTagChanges(const HdReprSelector& reprSelector);
+    TfTokenVector _GetDrawnRenderTags() const;
+
+    class _PurposeListener;
 
     /*! \brief  Hold all data related to the proxy shape.
 
@@ -203,6 +219,9 @@ private:
     std::unique_ptr<HdRenderIndex> _renderIndex;        //!< Flattened representation of client scene graph
     std::unique_ptr<HdxTaskController> _taskController; //!< Task controller necessary for execution with hydra engine (we don't really need it, but there doesn't seem to be a way to get synchronization running without it)
     std::unique_ptr<UsdImagingDelegate> _sceneDelegate; //!< USD scene delegate
+    std::unique_ptr<HdVP2PrimvarPrefetcher> _primvarPrefetcher; //!< Optional look-ahead primvar prefetcher used during playback
+    std::unique_ptr<HdVP2PlaybackCache> _playbackCache; //!< Optional cache of vertex buffers recorded during playback
+    std::unique_ptr<_PurposeListener> _purposeListener; //!< Tracks the prims whose purpose changed, to find the rprims whose render tag changed
 
     bool                    _isPopulated{ false };      //!< If false, scene delegate wasn't populated yet within render index
     bool                    _selectionChanged{ true };  //!< Whether there is any selection change or not
@@ -219,10 +238,31 @@ private:
 #endif
     bool _taskRenderTagsValid { false }; //!< If false the render tags on the dummy render task are not the minimum set of tags.
 
+    //! The rprim index version used the last time the render tag index was updated
+    unsigned int _rprimIndexVersion { 0 };
+
+    //! Rprim ids grouped by their last known render tag, used to find the rprims affected by purpose toggles
+    std::unordered_map<TfToken, SdfPathSet, TfToken::HashFunctor> _renderTagRprims;
+
+    //! Last known render tag of each rprim in the render index
+    std::unordered_map<SdfPath, TfToken, SdfPath::Hash> _rprimRenderTags;
+
+    //! Rprims whose render tag or visibility changed and whose render items must be updated regardless of the drawn render tags
+    SdfPathSet _renderTagChangedRprims;
+
     MHWRender::DisplayStatus _displayStatus{ MHWRender::kNoStatus }; //!< The display status of the proxy shape
     HdSelectionSharedPtr _leadSelection;                             //!< A collection of Rprims being lead selection
     HdSelectionSharedPtr _activeSelection;                           //!< A collection of Rprims being active selection
 
+    //! Selection status (lead or active) of the paths selected under the proxy shape, used to find selection changes
+    std::unordered_map<SdfPath, MHWRender::DisplayStatus, SdfPath::Hash> _selectionStatus;
+
+    //! The rprim index version used the last time the selection status was updated
+    unsigned int _selectionRprimIndexVersion { 0 };
+
+    //! If true, Rprims were inserted or removed since the selection was last populated
+    bool _selectionRprimsChanged { false };
+
 #if defined(WANT_UFE_BUILD)
     //! Observer to listen to UFE changes
     Ufe::Observer::Ptr  _observer;
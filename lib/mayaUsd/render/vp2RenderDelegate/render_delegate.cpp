@@ -800,6 +800,41 @@ const MHWRender::MSamplerState* HdVP2RenderDelegate::GetSamplerState(
     return samplerState;
 }
 
+/*! \brief  Returns the shader instance cached for a material network topology.
+
+    Materials sharing the same network topology share the same fragment graph, only the parameter
+    values differ. The returned shader instance holds the default parameter values and is owned by
+    the cache, materials should clone it. Call is thread safe.
+
+    \param topology    Description of the network topology, see HdVP2Material
+    \return The cached shader instance, null if none was cached for the topology
+*/
+MHWRender::MShaderInstance* HdVP2RenderDelegate::GetMaterialShader(const std::string& topology)
+{
+    tbb::spin_rw_mutex::scoped_lock lock(_materialShadersMutex, false/*write*/);
+
+    auto it = _materialShaders.find(topology);
+    return it != _materialShaders.end() ? it->second.get() : nullptr;
+}
+
+/*! \brief  Caches the shader instance created for a material network topology. Call is thread safe.
+
+    The cache takes ownership of the shader instance. The shader instance is released if another
+    one was cached for the topology in the meantime.
+*/
+void HdVP2RenderDelegate::AddMaterialShader(
+    const std::string& topology, MHWRender::MShaderInstance* shader)
+{
+    HdVP2ShaderUniquePtr shaderPtr(shader);
+    if (!shaderPtr) {
+        return;
+    }
+
+    tbb::spin_rw_mutex::scoped_lock lock(_materialShadersMutex, true/*write*/);
+
+    _materialShaders.emplace(topology, std::move(shaderPtr));
+}
+
 /*! \brief  Returns the shared bbox geometry.
 */
 const HdVP2BBoxGeom& HdVP2RenderDelegate::GetSharedBBoxGeom() const
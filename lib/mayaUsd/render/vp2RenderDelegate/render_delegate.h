@@ -18,6 +18,10 @@
 
 #include <mutex>
 #include <atomic>
+#include <string>
+#include <unordered_map>
+
+#include <tbb/spin_rw_mutex.h>
 
 #include <maya/MString.h>
 #include <maya/MShaderManager.h>
@@ -26,6 +30,7 @@
 #include <pxr/imaging/hd/renderDelegate.h>
 #include <pxr/imaging/hd/resourceRegistry.h>
 
+#include "material.h"
 #include "render_param.h"
 #include "resource_registry.h"
 
@@ -119,6 +124,9 @@ public:
 
     const HdVP2BBoxGeom& GetSharedBBoxGeom() const;
 
+    MHWRender::MShaderInstance* GetMaterialShader(const std::string& topology);
+    void AddMaterialShader(const std::string& topology, MHWRender::MShaderInstance* shader);
+
     static const int sProfilerCategory;                             //!< Profiler category
 
 private:
@@ -132,6 +140,10 @@ private:
     std::unique_ptr<HdVP2RenderParam>     _renderParam;             //!< Render param used to provided access to VP2 during prim synchronization
     SdfPath                               _id;                      //!< Render delegate IDs
     HdVP2ResourceRegistry                 _resourceRegistryVP2;     //!< VP2 resource registry used for enqueue and execution of commits
+
+    //! Shader instances of material networks, indexed by network topology
+    std::unordered_map<std::string, HdVP2ShaderUniquePtr> _materialShaders;
+    tbb::spin_rw_mutex                    _materialShadersMutex;    //!< Synchronization of concurrent material Sync calls
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
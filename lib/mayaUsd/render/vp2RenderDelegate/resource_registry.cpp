@@ -0,0 +1,98 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "resource_registry.h"
+
+#include <algorithm>
+
+#include <maya/MProfiler.h>
+
+#include "render_delegate.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Get the vertex adjacency table of a topology. Call is thread safe.
+
+    Tables are shared by all meshes with the same topology and are kept alive by the meshes
+    using them. A mesh needs to query its table again only when its topology changes, so
+    deforming meshes don't rebuild it when their points change.
+*/
+Hd_VertexAdjacencySharedPtr HdVP2ResourceRegistry::GetVertexAdjacency(
+    const HdMeshTopology& topology)
+{
+    const HdMeshTopology::ID topologyId = topology.ComputeHash();
+
+    {
+        std::lock_guard<std::mutex> lock(_adjacencyMutex);
+
+        const auto it = _adjacencies.find(topologyId);
+        if (it != _adjacencies.end() && it->second._topology == topology) {
+            Hd_VertexAdjacencySharedPtr adjacency = it->second._adjacency.lock();
+            if (adjacency) {
+                return adjacency;
+            }
+        }
+    }
+
+    // Build outside of the lock, meshes with different topologies can do it
+    // in parallel.
+    Hd_VertexAdjacencySharedPtr adjacency(new Hd_VertexAdjacency());
+    {
+        MProfilingScope profilingScope(HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorC_L2, "BuildVertexAdjacency");
+
+        HdBufferSourceSharedPtr adjacencyComputation =
+            adjacency->GetSharedAdjacencyBuilderComputation(&topology);
+        adjacencyComputation->Resolve();
+    }
+
+    std::lock_guard<std::mutex> lock(_adjacencyMutex);
+
+    auto result = _adjacencies.emplace(topologyId, _AdjacencyEntry());
+    _AdjacencyEntry& entry = result.first->second;
+    if (!result.second) {
+        // Another mesh may have built the same table meanwhile.
+        if (entry._topology == topology) {
+            Hd_VertexAdjacencySharedPtr existing = entry._adjacency.lock();
+            if (existing) {
+                return existing;
+            }
+        }
+        // Hash collision with a topology which is still in use, don't share.
+        else if (!entry._adjacency.expired()) {
+            return adjacency;
+        }
+    }
+
+    entry._topology = topology;
+    entry._adjacency = adjacency;
+
+    // Drop the tables no longer used by any mesh.
+    if (_adjacencies.size() >= _adjacencySweepSize) {
+        for (auto it = _adjacencies.begin(); it != _adjacencies.end(); ) {
+            if (it->second._adjacency.expired()) {
+                it = _adjacencies.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        _adjacencySweepSize = std::max<size_t>(64, _adjacencies.size() * 2);
+    }
+
+    return adjacency;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -16,11 +16,24 @@
 #ifndef HD_VP2_RESOURCE_REGISTRY
 #define HD_VP2_RESOURCE_REGISTRY
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include <tbb/concurrent_queue.h>
 #include <tbb/tbb_allocator.h>
 
+#include <mayaUsd/base/api.h>
+
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/imaging/hd/vertexAdjacency.h>
+
 #include "task_commit.h"
 
+#if USD_VERSION_NUM <= 2002
+#include <boost/weak_ptr.hpp>
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Central place to manage GPU resources commits and any resources not managed by VP2 directly
@@ -48,9 +61,34 @@ public:
     void EnqueueCommit(Body taskBody) {
         _commitTasks.push(HdVP2TaskCommitBody<Body>::construct(taskBody));
     }
+
+    //! \brief  Get the vertex adjacency table shared by meshes of this topology. Call is thread safe.
+    MAYAUSD_CORE_PUBLIC
+    Hd_VertexAdjacencySharedPtr GetVertexAdjacency(const HdMeshTopology& topology);
+
 private:
     //! Concurrent queue for commit tasks
     tbb::concurrent_queue<HdVP2TaskCommit*, tbb::tbb_allocator<HdVP2TaskCommit*>> _commitTasks;
+
+    //! Weak reference matching Hd_VertexAdjacencySharedPtr
+#if USD_VERSION_NUM > 2002
+    using _VertexAdjacencyWeakPtr = std::weak_ptr<Hd_VertexAdjacency>;
+#else
+    using _VertexAdjacencyWeakPtr = boost::weak_ptr<Hd_VertexAdjacency>;
+#endif
+
+    //! A vertex adjacency table and the topology it was built for
+    struct _AdjacencyEntry {
+        HdMeshTopology          _topology;
+        _VertexAdjacencyWeakPtr _adjacency;
+    };
+
+    //! Vertex adjacency tables shared by meshes, indexed by topology hash
+    std::unordered_map<HdMeshTopology::ID, _AdjacencyEntry> _adjacencies;
+    //! Number of entries above which expired tables get removed
+    size_t      _adjacencySweepSize{ 64 };
+    //! Synchronization of concurrent mesh synchronization
+    std::mutex  _adjacencyMutex;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -17,6 +17,8 @@
 
 #include <vector>
 
+#include <maya/MDagMessage.h>
+#include <maya/MNodeMessage.h>
 #include <maya/MSceneMessage.h>
 #include <maya/MMessage.h>
 
@@ -99,6 +101,16 @@ StagesSubject::StagesSubject()
 					MSceneMessage::kAfterNew, afterNewCallback, this, &res));
 	CHECK_MSTATUS(res);
 
+	// Renaming or repathing a Dag node changes the UFE paths of the proxy
+	// shapes below it, which invalidates the stage map resolved paths.
+	MObject allNodes;
+	fCbIds.append(MNodeMessage::addNameChangedCallback(
+					allNodes, nameChangedCallback, this, &res));
+	CHECK_MSTATUS(res);
+	fCbIds.append(MDagMessage::addAllDagChangesCallback(
+					dagChangedCallback, this, &res));
+	CHECK_MSTATUS(res);
+
 	TfWeakPtr<StagesSubject> me(this);
 	TfNotice::Register(me, &StagesSubject::onStageSet);
 	TfNotice::Register(me, &StagesSubject::onStageInvalidate);
@@ -160,6 +172,19 @@ void StagesSubject::afterOpenCallback(void* clientData)
 	ss->afterOpen();
 }
 
+/*static*/
+void StagesSubject::nameChangedCallback(MObject& node, const MString& prevName, void* clientData)
+{
+	if (node.hasFn(MFn::kDagNode))
+		g_StageMap.clearPathCache();
+}
+
+/*static*/
+void StagesSubject::dagChangedCallback(MDagMessage::DagMessage msgType, MDagPath& child, MDagPath& parent, void* clientData)
+{
+	g_StageMap.clearPathCache();
+}
+
 void StagesSubject::afterOpen()
 {
 	// Observe stage changes, for all stages.  Return listener object can
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <maya/MCallbackIdArray.h>
+#include <maya/MDagMessage.h>
 
 #include <ufe/ufe.h>            // For UFE_V2_FEATURES_AVAILABLE
 
@@ -71,6 +72,10 @@ private:
 	static void afterNewCallback(void* clientData);
 	static void afterOpenCallback(void* clientData);
 
+	// Maya Dag message callbacks
+	static void nameChangedCallback(MObject& node, const MString& prevName, void* clientData);
+	static void dagChangedCallback(MDagMessage::DagMessage msgType, MDagPath& child, MDagPath& parent, void* clientData);
+
 	//! Call the stageChanged() methods on stage observers.
 	void stageChanged(UsdNotice::ObjectsChanged const& notice, UsdStageWeakPtr const& sender);
 
@@ -28,6 +28,7 @@
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/base/tf/stringUtils.h>
 
+#include <mayaUsd/ufe/UsdStageMap.h>
 #include <mayaUsd/ufe/Utils.h>
 
 #include <mayaUsdUtils/util.h>
@@ -61,6 +62,8 @@ namespace {
 MAYAUSD_NS_DEF {
 namespace ufe {
 
+extern UsdStageMap g_StageMap;
+
 UsdHierarchy::UsdHierarchy(const UsdSceneItem::Ptr& item)
 	: Ufe::Hierarchy(), fItem(item), fPrim(item->prim())
 {
@@ -108,11 +111,17 @@ bool UsdHierarchy::hasChildren() const
 
 Ufe::SceneItemList UsdHierarchy::children() const
 {
-	// Return USD children only, i.e. children within this run-time.
+	// Return USD children only, i.e. children within this run-time.  The
+	// stage and USD path of the children are known, record them in the stage
+	// map so that later lookups of the child paths don't need to resolve them.
 	Ufe::SceneItemList children;
-	for (auto child : filteredChildren(fPrim))
+	UsdStageWeakPtr stage = fPrim.GetStage();
+	const Ufe::Path& parentPath = fItem->path();
+	for (const auto& child : filteredChildren(fPrim))
 	{
-		children.emplace_back(UsdSceneItem::create(fItem->path() + child.GetName(), child));
+		Ufe::Path childPath = parentPath + child.GetName();
+		g_StageMap.addPrimPath(childPath, stage, child.GetPath());
+		children.emplace_back(UsdSceneItem::create(childPath, child));
 	}
 	return children;
 }
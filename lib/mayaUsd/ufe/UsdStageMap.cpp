@@ -18,13 +18,17 @@
 #include <cassert>
 
 #include <maya/MFnDagNode.h>
+#include <maya/MItDependencyNodes.h>
 
-#include <mayaUsd/ufe/ProxyShapeHandler.h>
+#include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Utils.h>
 #include <mayaUsd/utils/util.h>
 
 namespace {
 
+// Upper bound on the number of resolved paths kept in the cache.
+constexpr size_t kMaxResolvedPaths = 1 << 16;
+
 MObjectHandle proxyShapeHandle(const Ufe::Path& path)
 {
 	// Get the MObjectHandle from the tail of the MDagPath.	 Remove the leading
@@ -98,6 +102,10 @@ UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path)
 {
 	rebuildIfDirty();
 
+	auto resolved = fResolvedPaths.find(path);
+	if (resolved != std::end(fResolvedPaths))
+		return resolved->second.stage;
+
 	auto proxyShape = proxyShapeHandle(path);
 	if (!proxyShape.isValid()) {
 		return nullptr;
@@ -105,11 +113,60 @@ UsdStageWeakPtr UsdStageMap::stage(const Ufe::Path& path)
 
 	// A stage is bound to a single Dag proxy shape.
 	auto iter = fObjectToStage.find(proxyShape);
-	if (iter != std::end(fObjectToStage))
+	if (iter != std::end(fObjectToStage)) {
+		addPrimPath(path, iter->second, SdfPath());
 		return iter->second;
+	}
 	return nullptr;
 }
 
+bool UsdStageMap::primPath(const Ufe::Path& path, UsdStageWeakPtr* stage, SdfPath* primPath)
+{
+	rebuildIfDirty();
+
+	auto resolved = fResolvedPaths.find(path);
+	if (resolved == std::end(fResolvedPaths)) {
+		// Assume that there are only two segments in the path, the first a
+		// Maya Dag path segment to the proxy shape, which identifies the
+		// stage, and the second the USD segment.
+		const Ufe::Path::Segments& segments = path.getSegments();
+		if (segments.size() != 2) {
+			return false;
+		}
+
+		auto proxyShapeStage = this->stage(Ufe::Path(segments[0]));
+		if (!proxyShapeStage) {
+			return false;
+		}
+
+		addPrimPath(path, proxyShapeStage, SdfPath(segments[1].string()));
+		resolved = fResolvedPaths.find(path);
+	}
+
+	if (resolved->second.primPath.IsEmpty()) {
+		return false;
+	}
+
+	*stage = resolved->second.stage;
+	*primPath = resolved->second.primPath;
+	return true;
+}
+
+void UsdStageMap::addPrimPath(const Ufe::Path& path, UsdStageWeakPtr stage, const SdfPath& primPath)
+{
+	// Start over rather than tracking usage, outliner expansion and scene
+	// traversals revisit recent paths.
+	if (fResolvedPaths.size() >= kMaxResolvedPaths) {
+		fResolvedPaths.clear();
+	}
+	fResolvedPaths[path] = ResolvedPath{stage, primPath};
+}
+
+void UsdStageMap::clearPathCache()
+{
+	fResolvedPaths.clear();
+}
+
 Ufe::Path UsdStageMap::path(UsdStageWeakPtr stage)
 {
 	rebuildIfDirty();
@@ -125,6 +182,7 @@ void UsdStageMap::setDirty()
 {
 	fObjectToStage.clear();
 	fStageToObject.clear();
+	fResolvedPaths.clear();
 	fDirty = true;
 }
 
@@ -132,13 +190,27 @@ void UsdStageMap::rebuildIfDirty()
 {
 	if (!fDirty) return;
 
-	auto proxyShapeNames = ProxyShapeHandler::getAllNames();
-	for (const auto& psn : proxyShapeNames)
+	// Iterate over proxy shape nodes directly, rather than resolving each of
+	// them by name.
+	for (MItDependencyNodes it(MFn::kPluginShape); !it.isDone(); it.next())
 	{
-		MDagPath dag = UsdMayaUtil::nameToDagPath(psn);
-		Ufe::Path ufePath = dagPathToUfe(dag);
-		auto stage = ProxyShapeHandler::dagPathToStage(psn);
-		addItem(ufePath, stage);
+		MFnDagNode dagNode(it.thisNode());
+		auto proxyShape = dynamic_cast<MayaUsdProxyShapeBase*>(dagNode.userNode());
+		if (!proxyShape)
+			continue;
+
+		// Assuming proxy shape nodes cannot be instanced, simply use the
+		// first path.
+		MDagPath dagPath;
+		if (dagNode.getPath(dagPath) != MS::kSuccess)
+			continue;
+
+		UsdPrim prim = proxyShape->usdPrim();
+		UsdStageWeakPtr stage = prim ? prim.GetStage() : nullptr;
+
+		MObjectHandle handle(dagPath.node());
+		fObjectToStage[handle] = stage;
+		fStageToObject[stage] = handle;
 	}
 	fDirty = false;
 }
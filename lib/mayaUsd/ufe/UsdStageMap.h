@@ -21,6 +21,7 @@
 
 #include <maya/MObjectHandle.h>
 
+#include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/base/tf/hash.h>
 
@@ -53,6 +54,11 @@ namespace ufe {
 	order of notification of Ufe observers.  An earlier implementation with
 	rename observation had the Maya Outliner (which observes rename) access the
 	UsdStageMap on rename before the UsdStageMap had been updated.
+
+	On top of this, UFE paths resolved to a stage and a USD prim path are
+	cached, since path lookups are very frequent.  Rather than being updated
+	on rename and repath, the cache is cleared by Maya DAG callbacks, so that
+	it never depends on the order of notification of Ufe observers.
 */
 class MAYAUSD_CORE_PUBLIC UsdStageMap
 {
@@ -72,6 +78,18 @@ public:
 	//! Return the ProxyShape node UFE path for the argument stage.
 	Ufe::Path path(UsdStageWeakPtr stage);
 
+	//! Get USD stage and prim path corresponding to argument UFE path to a
+	//! USD prim.  Returns false if the path is not a valid USD prim path.
+	bool primPath(const Ufe::Path& path, UsdStageWeakPtr* stage, SdfPath* primPath);
+
+	//! Record the USD stage and prim path of a UFE path to a USD prim, when
+	//! they are already known, e.g. when building child items.
+	void addPrimPath(const Ufe::Path& path, UsdStageWeakPtr stage, const SdfPath& primPath);
+
+	//! Clear the cache of resolved UFE paths.  Must be called when a Dag node
+	//! is renamed or repathed.
+	void clearPathCache();
+
 	//! Set the stage map as dirty. It will be cleared immediately, but
 	//! only repopulated when stage info is requested.
 	void setDirty();
@@ -91,6 +109,15 @@ private:
 	StageToObject fStageToObject;
 	bool fDirty{true};
 
+	// Cache of UFE paths to proxy shapes and USD prims, resolved to their
+	// stage and USD prim path (empty for proxy shapes).
+	struct ResolvedPath {
+		UsdStageWeakPtr stage;
+		SdfPath primPath;
+	};
+	using PathToResolvedPath = std::unordered_map<Ufe::Path, ResolvedPath>;
+	PathToResolvedPath fResolvedPaths;
+
 }; // UsdStageMap
 
 } // namespace ufe
@@ -15,6 +15,7 @@
 //
 
 #include "UsdTRSUndoableCommandBase.h"
+#include "UsdTransform3dEditBatch.h"
 #include "private/Utils.h"
 
 #include <ufe/scene.h>
@@ -46,7 +47,16 @@ void UsdTRSUndoableCommandBase<V>::initialize()
     // See
     // https://stackoverflow.com/questions/17853212/using-shared-from-this-in-templated-classes
     // for explanation of this->shared_from_this() in templated class.
-    attribute().Get(&fPrevValue);
+    // A value queued by another command for the same attribute is the
+    // current value, even if it's not authored yet.
+    VtValue queuedValue;
+    if (UsdTransform3dEditBatch::getQueuedValue(attribute(), &queuedValue) &&
+        queuedValue.IsHolding<V>()) {
+        fPrevValue = queuedValue.UncheckedGet<V>();
+    }
+    else {
+        attribute().Get(&fPrevValue);
+    }
     Ufe::Scene::instance().addObjectPathChangeObserver(this->shared_from_this());
 }
 
@@ -66,7 +76,7 @@ void UsdTRSUndoableCommandBase<V>::operator()(
 template<class V>
 void UsdTRSUndoableCommandBase<V>::undoImp()
 {
-    attribute().Set(fPrevValue);
+    setValue(fPrevValue);
     // Todo : We would want to remove the xformOp
     // (SD-06/07/2018) Haven't found a clean way to do it - would need to investigate
 }
@@ -78,13 +88,19 @@ void UsdTRSUndoableCommandBase<V>::redoImp()
     // perform(), otherwise we get "Empty typeName" USD assertions for rotate
     // and scale.  Once that is done, we can simply set the attribute directly.
     if (fDoneOnce) {
-        attribute().Set(fNewValue);
+        setValue(fNewValue);
         return;
     }
 
     perform(fNewValue[0], fNewValue[1], fNewValue[2]);
 }
 
+template<class V>
+void UsdTRSUndoableCommandBase<V>::setValue(const V& value)
+{
+    UsdTransform3dEditBatch::setValue(attribute(), VtValue(value));
+}
+
 template<class V>
 template<class N>
 void UsdTRSUndoableCommandBase<V>::checkNotification(const N* notification)
@@ -98,6 +114,18 @@ template<class V>
 void UsdTRSUndoableCommandBase<V>::perform(double x, double y, double z)
 {
     fNewValue = V(x, y, z);
+
+    // Once the common transform API has set up the transform op, repeated
+    // values (e.g. while manipulating) can be set directly, as in redoImp().
+    // They are queued, so that the values set by the commands of all the
+    // manipulated items are authored together.
+    if (fDoneOnce) {
+        UsdTransform3dEditBatch::queueValue(attribute(), VtValue(fNewValue));
+        return;
+    }
+
+    // A value queued for the attribute must not overwrite the one set here.
+    UsdTransform3dEditBatch::flush();
     performImp(x, y, z);
     fDoneOnce = true;
 }
@@ -40,6 +40,8 @@ namespace ufe {
 // - Keep track of the new value, in case it is set repeatedly (e.g. during
 //   interactive command use when manipulating, before the manipulation
 //   ends and the command is committed).
+// - Set values through UsdTransform3dEditBatch, so that edits of many items
+//   can be authored together.
 // - Keep track of the scene item, in case its path changes (e.g. when the
 //   prim is renamed or reparented).  A command can be created before it's
 //   used, or the undo / redo stack can cause an item to be renamed or
@@ -87,6 +89,10 @@ private:
 
     template<class N> void checkNotification(const N* notification);
 
+    // Set the attribute value through UsdTransform3dEditBatch, which queues
+    // it if a transform edit batch is open.
+    void setValue(const V& value);
+
     inline UsdAttribute attribute() const {
       return prim().GetAttribute(attributeName());
     }
@@ -20,6 +20,7 @@
 #include <mayaUsd/ufe/UsdRotatePivotTranslateUndoableCommand.h>
 #include <mayaUsd/ufe/UsdRotateUndoableCommand.h>
 #include <mayaUsd/ufe/UsdScaleUndoableCommand.h>
+#include <mayaUsd/ufe/UsdTransform3dEditBatch.h>
 #include <mayaUsd/ufe/UsdTranslateUndoableCommand.h>
 #include <mayaUsd/ufe/Utils.h>
 
@@ -43,8 +44,27 @@ namespace {
 		return uMat;
 	}
 
+	// Get the value of a transform op, including the value queued by a
+	// command being manipulated that is not authored yet.
+	template <class V>
+	bool getOpValue(const UsdPrim& prim, const TfToken& attrName, const UsdTimeCode& time, V* value)
+	{
+		const UsdAttribute attr = prim.GetAttribute(attrName);
+		VtValue queuedValue;
+		if (UsdTransform3dEditBatch::getQueuedValue(attr, &queuedValue) &&
+			queuedValue.IsHolding<V>() && !attr.ValueMightBeTimeVarying())
+		{
+			*value = queuedValue.UncheckedGet<V>();
+			return true;
+		}
+		return attr.Get<V>(value, time);
+	}
+
 	Ufe::Matrix4d primToUfeXform(const UsdPrim& prim, const UsdTimeCode& time)
 	{
+		// Matrices are computed from authored values only.
+		UsdTransform3dEditBatch::flush();
+
 		UsdGeomXformCache xformCache(time);
 		GfMatrix4d usdMatrix = xformCache.GetLocalToWorldTransform(prim);
 		Ufe::Matrix4d xform = convertFromUsd(usdMatrix);
@@ -53,6 +73,8 @@ namespace {
 
 	Ufe::Matrix4d primToUfeExclusiveXform(const UsdPrim& prim, const UsdTimeCode& time)
 	{
+		UsdTransform3dEditBatch::flush();
+
 		UsdGeomXformCache xformCache(time);
 		GfMatrix4d usdMatrix = xformCache.GetParentToWorldTransform(prim);
 		Ufe::Matrix4d xform = convertFromUsd(usdMatrix);
@@ -120,7 +142,7 @@ Ufe::Vector3d UsdTransform3d::translation() const
 	{
 		// Initially, attribute can be created, but have no value.
 		GfVec3d v;
-		if (fPrim.GetAttribute(xlate).Get<GfVec3d>(&v,getTime(path())))
+		if (getOpValue(fPrim, xlate, getTime(path()), &v))
 		{
 			x = v[0]; y = v[1]; z = v[2];
 		}
@@ -137,7 +159,7 @@ Ufe::Vector3d UsdTransform3d::rotation() const
 	{
 		// Initially, attribute can be created, but have no value.
 		GfVec3f v;
-		if (fPrim.GetAttribute(rotXYZ).Get<GfVec3f>(&v,getTime(path())))
+		if (getOpValue(fPrim, rotXYZ, getTime(path()), &v))
 		{
 			x = v[0]; y = v[1]; z = v[2];
 		}
@@ -153,7 +175,7 @@ Ufe::Vector3d UsdTransform3d::scale() const
 	{
 		// Initially, attribute can be created, but have no value.
 		GfVec3f v;
-		if (fPrim.GetAttribute(scaleTok).Get<GfVec3f>(&v,getTime(path())))
+		if (getOpValue(fPrim, scaleTok, getTime(path()), &v))
 		{
 			x = v[0]; y = v[1]; z = v[2];
 		}
@@ -220,7 +242,7 @@ Ufe::Vector3d UsdTransform3d::rotatePivot() const
 	{
 		// Initially, attribute can be created, but have no value.
 		GfVec3f v;
-		if (fPrim.GetAttribute(xpivot).Get<GfVec3f>(&v,getTime(path())))
+		if (getOpValue(fPrim, xpivot, getTime(path()), &v))
 		{
 			x = v[0]; y = v[1]; z = v[2];
 		}
@@ -0,0 +1,204 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UsdTransform3dEditBatch.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <pxr/base/tf/diagnostic.h>
+#include <pxr/usd/sdf/attributeSpec.h>
+#include <pxr/usd/sdf/changeBlock.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MGlobal.h>
+
+namespace {
+
+int editBatchCount = 0;
+
+struct PendingEdit
+{
+	PXR_NS::UsdAttribute attr;
+	PXR_NS::VtValue value;
+};
+
+// Pending edits in the order they were first queued, and their index by
+// stage and attribute path.
+std::vector<PendingEdit> pendingEdits;
+using PendingEditKey = std::pair<const PXR_NS::UsdStage*, PXR_NS::SdfPath>;
+std::map<PendingEditKey, size_t> pendingEditIndices;
+
+PendingEditKey pendingEditKey(const PXR_NS::UsdAttribute& attr)
+{
+	return std::make_pair(get_pointer(attr.GetStage()), attr.GetPath());
+}
+
+void queuePendingEdit(const PXR_NS::UsdAttribute& attr, const PXR_NS::VtValue& value)
+{
+	auto key = pendingEditKey(attr);
+	auto found = pendingEditIndices.find(key);
+	if (found != pendingEditIndices.end()) {
+		pendingEdits[found->second].value = value;
+		return;
+	}
+
+	pendingEditIndices.emplace(key, pendingEdits.size());
+	pendingEdits.push_back({attr, value});
+}
+
+void authorPendingEdits()
+{
+	if (pendingEdits.empty()) {
+		return;
+	}
+
+	std::vector<PendingEdit> edits;
+	edits.swap(pendingEdits);
+	pendingEditIndices.clear();
+
+	// Find the specs to author before opening the change block, as the Usd
+	// API must not be used while a change block is open.
+	std::vector<PXR_NS::SdfAttributeSpecHandle> specs;
+	specs.reserve(edits.size());
+	for (const PendingEdit& edit : edits) {
+		PXR_NS::SdfAttributeSpecHandle spec;
+		if (edit.attr) {
+			const PXR_NS::UsdEditTarget& editTarget =
+				edit.attr.GetStage()->GetEditTarget();
+			spec = editTarget.GetAttributeSpecForScenePath(edit.attr.GetPath());
+		}
+		specs.push_back(spec);
+	}
+
+	{
+		PXR_NS::SdfChangeBlock changeBlock;
+		for (size_t i = 0; i < edits.size(); ++i) {
+			if (specs[i]) {
+				specs[i]->SetDefaultValue(edits[i].value);
+			}
+		}
+	}
+
+	// Attributes without a spec in the edit target layer are authored
+	// through the Usd API, which creates the spec.
+	for (size_t i = 0; i < edits.size(); ++i) {
+		if (!specs[i] && edits[i].attr) {
+			edits[i].attr.Set(edits[i].value);
+		}
+	}
+}
+
+#if MAYA_API_VERSION >= 20190000
+// Whether authoring the values queued outside of a batch is scheduled on idle.
+bool flushScheduled = false;
+
+void flushOnIdle(void*)
+{
+	flushScheduled = false;
+	MAYAUSD_NS::ufe::UsdTransform3dEditBatch::flush();
+}
+#endif
+
+}
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+UsdTransform3dEditBatch::UsdTransform3dEditBatch()
+{
+	++editBatchCount;
+}
+
+UsdTransform3dEditBatch::~UsdTransform3dEditBatch()
+{
+	if (--editBatchCount < 0) {
+		TF_CODING_ERROR("Corrupt transform edit batch.");
+		editBatchCount = 0;
+	}
+
+	if (editBatchCount > 0) {
+		return;
+	}
+
+	authorPendingEdits();
+}
+
+/*static*/
+bool UsdTransform3dEditBatch::inBatch()
+{
+	return editBatchCount > 0;
+}
+
+/*static*/
+bool UsdTransform3dEditBatch::hasQueuedValues()
+{
+	return !pendingEdits.empty();
+}
+
+/*static*/
+void UsdTransform3dEditBatch::setValue(const UsdAttribute& attr, const VtValue& value)
+{
+	if (inBatch()) {
+		queuePendingEdit(attr, value);
+		return;
+	}
+
+	authorPendingEdits();
+	attr.Set(value);
+}
+
+/*static*/
+void UsdTransform3dEditBatch::queueValue(const UsdAttribute& attr, const VtValue& value)
+{
+#if MAYA_API_VERSION >= 20190000
+	if (!inBatch() && !flushScheduled) {
+		flushScheduled = true;
+		MGlobal::executeTaskOnIdle(flushOnIdle);
+	}
+	queuePendingEdit(attr, value);
+#else
+	// Values queued outside of a batch could only be authored by the next
+	// viewport refresh, which batch mode never does.
+	setValue(attr, value);
+#endif
+}
+
+/*static*/
+bool UsdTransform3dEditBatch::getQueuedValue(const UsdAttribute& attr, VtValue* value)
+{
+	auto found = pendingEditIndices.find(pendingEditKey(attr));
+	if (found == pendingEditIndices.end()) {
+		return false;
+	}
+
+	*value = pendingEdits[found->second].value;
+	return true;
+}
+
+/*static*/
+void UsdTransform3dEditBatch::flush()
+{
+	if (inBatch()) {
+		return;
+	}
+
+	authorPendingEdits();
+}
+
+} // namespace ufe
+} // namespace MayaUsd
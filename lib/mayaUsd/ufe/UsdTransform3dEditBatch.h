@@ -0,0 +1,95 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/usd/attribute.h>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+MAYAUSD_NS_DEF {
+namespace ufe {
+
+//! \brief Scoped batch of the transform edits made by translate, rotate and scale commands.
+/*!
+	Manipulating a multi-selection of USD prims executes one command per
+	item.  Authoring the value of each item separately makes USD send an
+	ObjectsChanged notice per item, each causing UFE notifications and
+	Hydra change processing.
+
+	While a batch is open, the translate, rotate and scale commands do not
+	author their values on existing transform ops right away.  The values
+	are authored when the outermost batch expires, on the specs of the edit
+	target layers and within a single SdfChangeBlock, so that each stage
+	sends a single notice for all the edited items.  Undo and redo of each
+	command are not affected.
+
+	Maya drives the commands of an interactive multi-selection manipulation
+	one item at a time, without telling when a drag tick ends.  The values
+	set repeatedly by a command being manipulated are therefore queued even
+	when no batch is open (see queueValue()), and authored together at the
+	next viewport refresh, or when Maya gets idle, whichever comes first
+	(see flush()).
+
+	Queued values are returned by getQueuedValue() until they are authored.
+	Batches can be nested.  Scripts and tools driving the edits of many
+	items open a batch around them, from Python with
+	mayaUsd.ufe.Transform3dEditBatch.
+ */
+class MAYAUSD_CORE_PUBLIC UsdTransform3dEditBatch
+{
+public:
+	UsdTransform3dEditBatch();
+	~UsdTransform3dEditBatch();
+
+	// Delete the copy/move constructors assignment operators.
+	UsdTransform3dEditBatch(const UsdTransform3dEditBatch&) = delete;
+	UsdTransform3dEditBatch& operator=(const UsdTransform3dEditBatch&) = delete;
+	UsdTransform3dEditBatch(UsdTransform3dEditBatch&&) = delete;
+	UsdTransform3dEditBatch& operator=(UsdTransform3dEditBatch&&) = delete;
+
+	//! Returns true if a batch is open.
+	static bool inBatch();
+
+	//! Returns true if values are queued and not authored yet.
+	static bool hasQueuedValues();
+
+	//! Set the default value of the attribute.  If a batch is open, the
+	//! value is queued, to be authored when the outermost batch expires.
+	//! Otherwise the values queued by queueValue() are authored first, so
+	//! that they don't overwrite this value later.
+	static void setValue(const UsdAttribute& attr, const VtValue& value);
+
+	//! Queue the default value of the attribute, even if no batch is open.
+	//! The value is authored when the outermost batch expires, or otherwise
+	//! at the next flush().  A value queued for an attribute replaces the
+	//! value previously queued for it.
+	static void queueValue(const UsdAttribute& attr, const VtValue& value);
+
+	//! Get the value queued for the attribute.  Returns false if no value
+	//! is queued for it.
+	static bool getQueuedValue(const UsdAttribute& attr, VtValue* value);
+
+	//! Author the values queued while no batch is open.  Called before the
+	//! viewport draws USD stages, and when Maya gets idle.  Does nothing
+	//! while a batch is open.
+	static void flush();
+}; // UsdTransform3dEditBatch
+
+} // namespace ufe
+} // namespace MayaUsd
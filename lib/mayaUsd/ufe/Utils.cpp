@@ -87,10 +87,14 @@ UsdPrim ufePathToPrim(const Ufe::Path& path)
 	const Ufe::Path::Segments& segments = path.getSegments();
 	TEST_USD_PATH(segments, path);
 
+	// Resolved paths are cached by the stage map, to avoid looking up the
+	// proxy shape and converting the USD segment to an SdfPath every time.
 	UsdPrim prim;
-	if (auto stage = getStage(Ufe::Path(segments[0])))
+	UsdStageWeakPtr stage;
+	SdfPath primPath;
+	if (g_StageMap.primPath(path, &stage, &primPath) && stage)
 	{
-		prim = stage->GetPrimAtPath(SdfPath(segments[1].string()));
+		prim = stage->GetPrimAtPath(primPath);
 	}
 	return prim;
 }
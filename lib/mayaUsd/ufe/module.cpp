@@ -19,5 +19,6 @@
 PXR_NAMESPACE_USING_DIRECTIVE
 
 TF_WRAP_MODULE {
+    TF_WRAP(Transform3dEditBatch);
     TF_WRAP(Utils);
 }
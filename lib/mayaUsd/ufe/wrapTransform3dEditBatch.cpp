@@ -0,0 +1,63 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <memory>
+
+#include <boost/noncopyable.hpp>
+#include <boost/python.hpp>
+
+#include <mayaUsd/ufe/UsdTransform3dEditBatch.h>
+
+using namespace MayaUsd;
+using namespace boost::python;
+
+namespace {
+
+// Python context manager opening a transform edit batch, for scripts and
+// tools that drive the transform edits of many items, e.g.
+//
+//     with mayaUsd.ufe.Transform3dEditBatch():
+//         for cmd in commands:
+//             cmd.redo()
+//
+class _PyTransform3dEditBatch {
+public:
+    void __enter__() {
+        _batch.reset(new ufe::UsdTransform3dEditBatch());
+    }
+    void __exit__(object, object, object) {
+        _batch.reset();
+    }
+
+private:
+    std::unique_ptr<ufe::UsdTransform3dEditBatch> _batch;
+};
+
+} // anonymous namespace
+
+void wrapTransform3dEditBatch()
+{
+    typedef _PyTransform3dEditBatch Batch;
+    class_<Batch, boost::noncopyable>("Transform3dEditBatch")
+        .def("__enter__", &Batch::__enter__, return_self<>())
+        .def("__exit__", &Batch::__exit__)
+        .def("inBatch", &ufe::UsdTransform3dEditBatch::inBatch)
+        .staticmethod("inBatch")
+        .def("hasQueuedValues", &ufe::UsdTransform3dEditBatch::hasQueuedValues)
+        .staticmethod("hasQueuedValues")
+        .def("flush", &ufe::UsdTransform3dEditBatch::flush)
+        .staticmethod("flush")
+        ;
+}
@@ -21,6 +21,8 @@
 #include <maya/MArrayDataHandle.h>
 #include <maya/MDataBlock.h>
 #include <maya/MFnData.h>
+#include <maya/MFnDoubleArrayData.h>
+#include <maya/MFnFloatArrayData.h>
 #include <maya/MFnIntArrayData.h>
 #include <maya/MFnMatrixArrayData.h>
 #include <maya/MFnPointArrayData.h>
@@ -47,6 +49,8 @@
 | Matrix4d         | GfMatrix4d            | MFnData::kMatrix,  MFn::kMatrixData                            | MMatrix, MFnMatrixData  | MakeMayaFnData     |
 ||
 | IntArray         | VtArray< int >        | MFnData::kIntArray, MFn::kIntArrayData                | MIntArray, MFnIntArrayData       | MakeMayaFnData     |
+| FloatArray       | VtArray< float >      | MFnData::kFloatArray, MFn::kFloatArrayData            | MFloatArray, MFnFloatArrayData   | MakeMayaFnData     |
+| DoubleArray      | VtArray< double >     | MFnData::kDoubleArray, MFn::kDoubleArrayData          | MDoubleArray, MFnDoubleArrayData | MakeMayaFnData     |
 | Point3fArray     | VtArray< GfVec3f >    | MFnData::kPointArray, MFn::kPointArrayData            | MPointArray, MFnPointArrayData   | MakeMayaFnData     |
 | Matrix4dArray    | VtArray< GfMatrix4d > | MFnData::kMatrixArray, MFn::kMatrixArrayData          | MMatrixArray, MFnMatrixArrayData | MakeMayaFnData     |
 
@@ -246,6 +250,68 @@ MAYAUSD_NS_DEF
         }
     };
 
+    //! \brief  Type trait for Maya's MFloatArray type providing get and set methods for data handle
+    //! and plugs.
+    template <> struct MakeMayaFnData<MFloatArray> : public std::true_type {
+        using Type = MFloatArray;
+        using FnType = MFnFloatArrayData;
+        enum { kDataType = MFnData::kFloatArray };
+        enum { kApiType = MFn::kFloatArrayData };
+
+        static MObject create(FnType& data) { return data.create(); }
+
+        static void get(const FnType& data, Type& value) { data.copyTo(value); }
+
+        static void set(FnType& data, const Type& value) { data.set(value); }
+
+        static void get(const MDataHandle& handle, Type& value)
+        {
+            MObject dataObj = const_cast<MDataHandle&>(handle).data();
+            FnType  dataFn(dataObj);
+            get(dataFn, value);
+        }
+
+        static void set(MDataHandle& handle, const Type& value)
+        {
+            FnType  dataFn;
+            MObject dataObj = create(dataFn);
+            set(dataFn, value);
+
+            handle.setMObject(dataObj);
+        }
+    };
+
+    //! \brief  Type trait for Maya's MDoubleArray type providing get and set methods for data handle
+    //! and plugs.
+    template <> struct MakeMayaFnData<MDoubleArray> : public std::true_type {
+        using Type = MDoubleArray;
+        using FnType = MFnDoubleArrayData;
+        enum { kDataType = MFnData::kDoubleArray };
+        enum { kApiType = MFn::kDoubleArrayData };
+
+        static MObject create(FnType& data) { return data.create(); }
+
+        static void get(const FnType& data, Type& value) { data.copyTo(value); }
+
+        static void set(FnType& data, const Type& value) { data.set(value); }
+
+        static void get(const MDataHandle& handle, Type& value)
+        {
+            MObject dataObj = const_cast<MDataHandle&>(handle).data();
+            FnType  dataFn(dataObj);
+            get(dataFn, value);
+        }
+
+        static void set(MDataHandle& handle, const Type& value)
+        {
+            FnType  dataFn;
+            MObject dataObj = create(dataFn);
+            set(dataFn, value);
+
+            handle.setMObject(dataObj);
+        }
+    };
+
     //! \brief  Type trait for Maya's MPointArray type providing get and set methods for data handle
     //! and plugs.
     template <> struct MakeMayaFnData<MPointArray> : public std::true_type {
@@ -371,6 +437,23 @@ MAYAUSD_NS_DEF
         static void set(MDataHandle& handle, const Type& value) { handle.setString(value); }
     };
 
+    //---------------------------------------------------------------------------------
+    //! \brief  Type trait enabled for Maya array types which are converted in place, i.e. read
+    //! from and written to the array owned by the data object without an intermediate Maya array.
+    //! The array returned by the data function set references the data of the object.
+    template <class MAYA_Type> struct MakeMayaInPlaceArray : public std::false_type {
+    };
+    template <> struct MakeMayaInPlaceArray<MIntArray> : public std::true_type {
+    };
+    template <> struct MakeMayaInPlaceArray<MFloatArray> : public std::true_type {
+    };
+    template <> struct MakeMayaInPlaceArray<MDoubleArray> : public std::true_type {
+    };
+    template <> struct MakeMayaInPlaceArray<MPointArray> : public std::true_type {
+    };
+    template <> struct MakeMayaInPlaceArray<MMatrixArray> : public std::true_type {
+    };
+
     //---------------------------------------------------------------------------------
     //! \brief  Helper classe to provide single a interface for data handles of simple and complex
     //! types.
@@ -423,6 +506,23 @@ MAYAUSD_NS_DEF
         {
             FnTypeHelper::set(handle, value);
         }
+
+        template <class USD_Type> static void getInPlace(const MDataHandle& handle, USD_Type& value)
+        {
+            MObject                       dataObj = const_cast<MDataHandle&>(handle).data();
+            typename FnTypeHelper::FnType dataFn(dataObj);
+            TypedConverter<MAYA_Type, USD_Type>::convert(dataFn.array(), value);
+        }
+
+        template <class USD_Type> static void setInPlace(MDataHandle& handle, const USD_Type& value)
+        {
+            typename FnTypeHelper::FnType dataFn;
+            MObject                       dataObj = FnTypeHelper::create(dataFn);
+            MAYA_Type                     array = dataFn.array();
+            TypedConverter<MAYA_Type, USD_Type>::convert(value, array);
+
+            handle.setMObject(dataObj);
+        }
     };
 
     //---------------------------------------------------------------------------------
@@ -473,6 +573,23 @@ MAYAUSD_NS_DEF
 
             plug.setMObject(dataObj);
         }
+
+        template <class USD_Type> static void getInPlace(const MPlug& plug, USD_Type& value)
+        {
+            MObject                       dataObj = plug.asMObject();
+            typename FnTypeHelper::FnType dataFn(dataObj);
+            TypedConverter<MAYA_Type, USD_Type>::convert(dataFn.array(), value);
+        }
+
+        template <class USD_Type> static void setInPlace(MPlug& plug, const USD_Type& value)
+        {
+            typename FnTypeHelper::FnType dataFn;
+            MObject                       dataObj = FnTypeHelper::create(dataFn);
+            MAYA_Type                     array = dataFn.array();
+            TypedConverter<MAYA_Type, USD_Type>::convert(value, array);
+
+            plug.setMObject(dataObj);
+        }
     };
 
     //---------------------------------------------------------------------------------
@@ -511,6 +628,17 @@ MAYAUSD_NS_DEF
 
             dst.newPlugValue(plug, dataObj);
         }
+
+        template <class USD_Type>
+        static void setInPlace(const MPlug& plug, MDGModifier& dst, const USD_Type& value)
+        {
+            typename FnTypeHelper::FnType dataFn;
+            MObject                       dataObj = FnTypeHelper::create(dataFn);
+            MAYA_Type                     array = dataFn.array();
+            TypedConverter<MAYA_Type, USD_Type>::convert(value, array);
+
+            dst.newPlugValue(plug, dataObj);
+        }
     };
 
     //! \brief  Specialization for MString class which has a different way of setting new string
@@ -533,7 +661,9 @@ MAYAUSD_NS_DEF
     struct MDataHandleConvert {
         // MDataHandle <--> USD_Type
         template <NeedsGammaCorrection C = ColorCorrection>
-        static typename std::enable_if<C == NeedsGammaCorrection::kNo, void>::type
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && !MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
         convert(const USD_Type& src, MDataHandle& dst, const ConverterArgs&)
         {
             MAYA_Type tmpDst;
@@ -541,13 +671,31 @@ MAYAUSD_NS_DEF
             MDataHandleUtils<MAYA_Type>::set(dst, tmpDst);
         }
         template <NeedsGammaCorrection C = ColorCorrection>
-        static typename std::enable_if<C == NeedsGammaCorrection::kNo, void>::type
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && !MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
         convert(const MDataHandle& src, USD_Type& dst, const ConverterArgs&)
         {
             MAYA_Type tmpSrc;
             MDataHandleUtils<MAYA_Type>::get(src, tmpSrc);
             TypedConverter<MAYA_Type, USD_Type>::convert(tmpSrc, dst);
         }
+        template <NeedsGammaCorrection C = ColorCorrection>
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
+        convert(const USD_Type& src, MDataHandle& dst, const ConverterArgs&)
+        {
+            MDataHandleUtils<MAYA_Type>::setInPlace(dst, src);
+        }
+        template <NeedsGammaCorrection C = ColorCorrection>
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
+        convert(const MDataHandle& src, USD_Type& dst, const ConverterArgs&)
+        {
+            MDataHandleUtils<MAYA_Type>::getInPlace(src, dst);
+        }
 
         template <NeedsGammaCorrection C = ColorCorrection>
         static typename std::enable_if<C == NeedsGammaCorrection::kYes, void>::type
@@ -604,7 +752,9 @@ MAYAUSD_NS_DEF
     struct MPlugConvert {
         // MPlug <--> USD_Type
         template <NeedsGammaCorrection C = ColorCorrection>
-        static typename std::enable_if<C == NeedsGammaCorrection::kNo, void>::type
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && !MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
         convert(const USD_Type& src, MPlug& dst, const ConverterArgs&)
         {
             MAYA_Type tmpDst;
@@ -612,7 +762,9 @@ MAYAUSD_NS_DEF
             MPlugUtils<MAYA_Type>::set(dst, tmpDst);
         }
         template <NeedsGammaCorrection C = ColorCorrection>
-        static typename std::enable_if<C == NeedsGammaCorrection::kNo, void>::type
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && !MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
         convert(const MPlug& src, USD_Type& dst, const ConverterArgs&)
         {
             MAYA_Type tmpSrc;
@@ -620,13 +772,39 @@ MAYAUSD_NS_DEF
             TypedConverter<MAYA_Type, USD_Type>::convert(tmpSrc, dst);
         }
         template <NeedsGammaCorrection C = ColorCorrection>
-        static typename std::enable_if<C == NeedsGammaCorrection::kNo, void>::type
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && !MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
         convert(const USD_Type& src, const MPlug& plug, MDGModifier& dst, const ConverterArgs&)
         {
             MAYA_Type tmpDst;
             TypedConverter<MAYA_Type, USD_Type>::convert(src, tmpDst);
             MDGModifierUtils<MAYA_Type>::set(plug, dst, tmpDst);
         }
+        template <NeedsGammaCorrection C = ColorCorrection>
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
+        convert(const USD_Type& src, MPlug& dst, const ConverterArgs&)
+        {
+            MPlugUtils<MAYA_Type>::setInPlace(dst, src);
+        }
+        template <NeedsGammaCorrection C = ColorCorrection>
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
+        convert(const MPlug& src, USD_Type& dst, const ConverterArgs&)
+        {
+            MPlugUtils<MAYA_Type>::getInPlace(src, dst);
+        }
+        template <NeedsGammaCorrection C = ColorCorrection>
+        static typename std::enable_if<
+            C == NeedsGammaCorrection::kNo && MakeMayaInPlaceArray<MAYA_Type>::value,
+            void>::type
+        convert(const USD_Type& src, const MPlug& plug, MDGModifier& dst, const ConverterArgs&)
+        {
+            MDGModifierUtils<MAYA_Type>::setInPlace(plug, dst, src);
+        }
 
         template <NeedsGammaCorrection C = ColorCorrection>
         static typename std::enable_if<C == NeedsGammaCorrection::kYes, void>::type
@@ -946,6 +1124,9 @@ MAYAUSD_NS_DEF
                 converters, SdfValueTypeNames->Color3d);
 
             createConverter<MIntArray, VtArray<int>>(converters, SdfValueTypeNames->IntArray);
+            createConverter<MFloatArray, VtArray<float>>(converters, SdfValueTypeNames->FloatArray);
+            createConverter<MDoubleArray, VtArray<double>>(
+                converters, SdfValueTypeNames->DoubleArray);
             createConverter<MPointArray, VtArray<GfVec3f>>(
                 converters, SdfValueTypeNames->Point3fArray);
             createConverter<MMatrixArray, VtArray<GfMatrix4d>>(
@@ -27,6 +27,8 @@
 
 #include <maya/MDGModifier.h>
 #include <maya/MDataHandle.h>
+#include <maya/MDoubleArray.h>
+#include <maya/MFloatArray.h>
 #include <maya/MFnMatrixData.h>
 #include <maya/MFnNumericAttribute.h>
 #include <maya/MFnTypedAttribute.h>
@@ -37,6 +39,8 @@
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
 
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 MAYAUSD_NS_DEF
@@ -405,34 +409,77 @@ MAYAUSD_NS_DEF
     template <> struct TypedConverter<MIntArray, VtArray<int>> {
         static void convert(const VtArray<int>& src, MIntArray& dst)
         {
-            const size_t srcSize = src.size();
-            dst.setLength(srcSize);
-            for (size_t i = 0; i < srcSize; i++) { dst[i] = src[i]; }
+            dst = MIntArray(src.cdata(), static_cast<unsigned int>(src.size()));
         }
         static void convert(const MIntArray& src, VtArray<int>& dst)
         {
-            const size_t srcSize = src.length();
-            dst.resize(srcSize);
-            for (size_t i = 0; i < srcSize; i++) { dst[i] = src[i]; }
+            dst.resize(src.length());
+            src.get(dst.data());
+        }
+    };
+
+    //! \brief  Specialization of TypedConverter for MFloatArray <--> VtArray<float>
+    template <> struct TypedConverter<MFloatArray, VtArray<float>> {
+        static void convert(const VtArray<float>& src, MFloatArray& dst)
+        {
+            dst = MFloatArray(src.cdata(), static_cast<unsigned int>(src.size()));
+        }
+        static void convert(const MFloatArray& src, VtArray<float>& dst)
+        {
+            dst.resize(src.length());
+            src.get(dst.data());
+        }
+    };
+
+    //! \brief  Specialization of TypedConverter for MDoubleArray <--> VtArray<double>
+    template <> struct TypedConverter<MDoubleArray, VtArray<double>> {
+        static void convert(const VtArray<double>& src, MDoubleArray& dst)
+        {
+            dst = MDoubleArray(src.cdata(), static_cast<unsigned int>(src.size()));
+        }
+        static void convert(const MDoubleArray& src, VtArray<double>& dst)
+        {
+            dst.resize(src.length());
+            src.get(dst.data());
         }
     };
 
     //! \brief  Specialization of TypedConverter for MPointArray <--> VtArray<GfVec3f>
+    //!
+    //!         MPointArray only gives bulk access to its storage through copies of 4 doubles per
+    //!         point. Points are widened or narrowed in a tight loop over that copy, instead of
+    //!         going through the per element accessors of both arrays.
     template <> struct TypedConverter<MPointArray, VtArray<GfVec3f>> {
         static void convert(const VtArray<GfVec3f>& src, MPointArray& dst)
         {
-            const size_t srcSize = src.size();
-            dst.setLength(srcSize);
+            const size_t        srcSize = src.size();
+            const float*        srcData = srcSize ? src.cdata()->data() : nullptr;
+            std::vector<double> buffer(srcSize * 4);
+            double*             bufferData = buffer.data();
             for (size_t i = 0; i < srcSize; i++) {
-                TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
+                bufferData[i * 4 + 0] = srcData[i * 3 + 0];
+                bufferData[i * 4 + 1] = srcData[i * 3 + 1];
+                bufferData[i * 4 + 2] = srcData[i * 3 + 2];
+                bufferData[i * 4 + 3] = 1.0;
             }
+            dst = MPointArray(
+                reinterpret_cast<const double(*)[4]>(bufferData),
+                static_cast<unsigned int>(srcSize));
         }
         static void convert(const MPointArray& src, VtArray<GfVec3f>& dst)
         {
-            const size_t srcSize = src.length();
+            const size_t        srcSize = src.length();
+            std::vector<double> buffer(srcSize * 4);
+            double*             bufferData = buffer.data();
+            if (srcSize) {
+                src.get(reinterpret_cast<double(*)[4]>(bufferData));
+            }
             dst.resize(srcSize);
+            float* dstData = srcSize ? dst.data()->data() : nullptr;
             for (size_t i = 0; i < srcSize; i++) {
-                TypedConverter<MPoint, GfVec3f>::convert(src[i], dst[i]);
+                dstData[i * 3 + 0] = static_cast<float>(bufferData[i * 4 + 0]);
+                dstData[i * 3 + 1] = static_cast<float>(bufferData[i * 4 + 1]);
+                dstData[i * 3 + 2] = static_cast<float>(bufferData[i * 4 + 2]);
             }
         }
     };
@@ -444,15 +491,16 @@ MAYAUSD_NS_DEF
             const size_t srcSize = src.size();
             dst.setLength(srcSize);
             for (size_t i = 0; i < srcSize; i++) {
-                TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+                TypedConverter<MMatrix, GfMatrix4d>::convert(src.cdata()[i], dst[i]);
             }
         }
         static void convert(const MMatrixArray& src, VtArray<GfMatrix4d>& dst)
         {
             const size_t srcSize = src.length();
             dst.resize(srcSize);
+            GfMatrix4d* dstData = dst.data();
             for (size_t i = 0; i < srcSize; i++) {
-                TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dst[i]);
+                TypedConverter<MMatrix, GfMatrix4d>::convert(src[i], dstData[i]);
             }
         }
     };
@@ -147,4 +147,40 @@ UsdMayaStageCache::GetSharedSessionLayer(
     }
 }
 
+SdfLayerRefPtr
+UsdMayaStageCache::GetSharedEditedSessionLayer(
+    const SdfPath& rootPath,
+    const std::map<std::string, std::string>& variantSelections,
+    const TfToken& drawMode,
+    const std::string& editsKey,
+    bool* isNew)
+{
+    // The shared session layer is sublayered rather than copied, so that
+    // only the edits are held by the returned layer.
+    SdfLayerRefPtr sharedLayer =
+        GetSharedSessionLayer(rootPath, variantSelections, drawMode);
+
+    // Example key: "anon:0x1234:edits" - shared layer keys start with a path,
+    // so the two kinds of keys never collide.
+    std::string keyString = sharedLayer->GetIdentifier() + ":" + editsKey;
+    std::lock_guard<std::mutex> lock(_sharedSessionLayersMutex);
+    auto iter = _sharedSessionLayers.find(keyString);
+    if (iter == _sharedSessionLayers.end()) {
+        SdfLayerRefPtr newLayer = SdfLayer::CreateAnonymous();
+        newLayer->GetSubLayerPaths().push_back(sharedLayer->GetIdentifier());
+
+        _sharedSessionLayers[keyString] = newLayer;
+        if (isNew) {
+            *isNew = true;
+        }
+        return newLayer;
+    }
+    else {
+        if (isNew) {
+            *isNew = false;
+        }
+        return iter->second;
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
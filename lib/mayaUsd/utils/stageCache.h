@@ -57,6 +57,23 @@ public:
             const SdfPath& rootPath,
             const std::map<std::string, std::string>& variantSelections,
             const TfToken& drawMode);
+
+    /// Gets (or creates) a session layer meant to hold the opinions of a set
+    /// of edits identified by \p editsKey. The layer sublayers the shared
+    /// session layer tied with the given variant selections and draw mode,
+    /// so that the stages of all the models with the same edits share it.
+    /// \p isNew is set to true if the layer was created by this call, in
+    /// which case the caller is responsible for authoring the edits in it.
+    /// Note that only the layers are shared between sets of edits: each set
+    /// of edits gets its own stage, which composes the unedited opinions
+    /// again.
+    MAYAUSD_CORE_PUBLIC
+    static SdfLayerRefPtr GetSharedEditedSessionLayer(
+            const SdfPath& rootPath,
+            const std::map<std::string, std::string>& variantSelections,
+            const TfToken& drawMode,
+            const std::string& editsKey,
+            bool* isNew = nullptr);
 };
 
 
@@ -0,0 +1,146 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "stageWarmUp.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <pxr/base/tf/envSetting.h>
+#include <pxr/base/tf/instantiateType.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usd/attribute.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/imageable.h>
+
+#include <mayaUsd/base/debugCodes.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DEFINE_ENV_SETTING(MAYAUSD_STAGE_WARM_UP, false,
+    "Resolve the values of newly opened USD stages on worker threads before "
+    "they get drawn.");
+
+TF_INSTANTIATE_TYPE(UsdMayaStageWarmUpNotice,
+                    TfType::CONCRETE, TF_1_PARENT(TfNotice));
+
+namespace {
+
+// Number of prims processed between two progress notices and cancellation
+// checks.
+constexpr size_t kBatchSize = 4096;
+
+void
+_WarmUpPrim(const UsdPrim& prim)
+{
+    // Reading the values pages in the layer data they come from, so that the
+    // first reads on the main thread don't wait for it.
+    VtValue value;
+    for (const UsdAttribute& attr : prim.GetAuthoredAttributes()) {
+        attr.Get(&value, UsdTimeCode::Default());
+    }
+}
+
+} // anonymous namespace
+
+UsdMayaStageWarmUp::UsdMayaStageWarmUp(const UsdStageRefPtr& stage)
+    : _stage(stage)
+{
+}
+
+void
+UsdMayaStageWarmUp::Run()
+{
+    const UsdStageWeakPtr stage(_stage);
+    Run([stage](size_t processedPrimCount, size_t primCount) {
+        UsdMayaStageWarmUpNotice(stage, processedPrimCount, primCount).Send();
+    });
+}
+
+void
+UsdMayaStageWarmUp::Run(const ProgressFn& progress)
+{
+    TRACE_FUNCTION();
+
+    if (!_stage) {
+        return;
+    }
+
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim& prim : _stage->Traverse()) {
+        if (_cancelled) {
+            return;
+        }
+        if (prim.IsA<UsdGeomImageable>()) {
+            prims.push_back(prim);
+        }
+    }
+
+    TF_DEBUG(USDMAYA_PROXYSHAPEBASE).Msg(
+        "UsdMayaStageWarmUp::Run warming up %zu prims of %s\n",
+        prims.size(), _stage->GetRootLayer()->GetIdentifier().c_str());
+
+    size_t processedPrimCount = 0;
+    while (processedPrimCount < prims.size() && !_cancelled) {
+        const size_t batchBegin = processedPrimCount;
+        const size_t batchEnd = std::min(batchBegin + kBatchSize, prims.size());
+
+        WorkParallelForN(batchEnd - batchBegin,
+            [this, &prims, batchBegin](size_t begin, size_t end) {
+                for (size_t i = begin; i < end && !_cancelled; ++i) {
+                    _WarmUpPrim(prims[batchBegin + i]);
+                }
+            });
+
+        processedPrimCount = _cancelled ? batchBegin : batchEnd;
+        if (progress) {
+            progress(processedPrimCount, prims.size());
+        }
+    }
+}
+
+void
+UsdMayaStageWarmUp::Cancel()
+{
+    _cancelled = true;
+}
+
+bool
+UsdMayaStageWarmUp::IsCancelled() const
+{
+    return _cancelled;
+}
+
+/* static */
+bool
+UsdMayaStageWarmUp::IsEnabled()
+{
+    return TfGetEnvSetting(MAYAUSD_STAGE_WARM_UP);
+}
+
+UsdMayaStageWarmUpNotice::UsdMayaStageWarmUpNotice(
+        const UsdStageWeakPtr& stage,
+        size_t processedPrimCount,
+        size_t primCount)
+    : _stage(stage)
+    , _processedPrimCount(processedPrimCount)
+    , _primCount(primCount)
+{
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
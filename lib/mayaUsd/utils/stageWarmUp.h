@@ -0,0 +1,120 @@
+//
+// Copyright 2020 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_STAGEWARMUP_H
+#define PXRUSDMAYA_STAGEWARMUP_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+#include <pxr/pxr.h>
+#include <pxr/base/tf/notice.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <mayaUsd/base/api.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Resolves the values a newly opened stage needs for its first draw, on
+/// worker threads.
+///
+/// The prim indexes of a stage are composed when it gets opened, but the
+/// values of its attributes are resolved lazily, the first time a client
+/// reads them. For large stages, the first draw, bounding box request and
+/// outliner expansion then spend most of their time resolving values and
+/// paging in the layer data they come from, all on the main thread. The
+/// warm-up resolves the default time values of the imageable prims in
+/// parallel instead, right after the stage is opened.
+///
+/// The stage must not be edited while the warm-up runs. A warm-up running on
+/// a worker thread should therefore not make the stage visible to other
+/// clients (e.g. in a stage cache) until it is done, whereas a warm-up run
+/// from the main thread blocks its clients until then.
+class UsdMayaStageWarmUp
+{
+public:
+    /// Function called after each batch of prims, with the number of prims
+    /// processed so far and the number of imageable prims of the stage.
+    using ProgressFn = std::function<void(size_t processedPrimCount, size_t primCount)>;
+
+    MAYAUSD_CORE_PUBLIC
+    explicit UsdMayaStageWarmUp(const UsdStageRefPtr& stage);
+
+    /// Traverse the stage and resolve its values. Returns once all the
+    /// imageable prims are processed or once the warm-up gets cancelled.
+    /// A UsdMayaStageWarmUpNotice is sent, from the calling thread, after
+    /// each batch of prims.
+    MAYAUSD_CORE_PUBLIC
+    void Run();
+
+    /// Same as Run(), but calls \p progress from the calling thread after
+    /// each batch of prims instead of sending a notice. Warm-ups running on
+    /// worker threads use it to send their notices from the main thread.
+    MAYAUSD_CORE_PUBLIC
+    void Run(const ProgressFn& progress);
+
+    /// Stop the warm-up after the prims being processed. Call is thread safe.
+    MAYAUSD_CORE_PUBLIC
+    void Cancel();
+
+    MAYAUSD_CORE_PUBLIC
+    bool IsCancelled() const;
+
+    /// Return whether stages should be warmed up after they are opened, as
+    /// configured by the MAYAUSD_STAGE_WARM_UP environment variable.
+    MAYAUSD_CORE_PUBLIC
+    static bool IsEnabled();
+
+private:
+    UsdStageRefPtr      _stage;
+    std::atomic<bool>   _cancelled{ false };
+};
+
+/// Notice sent as the warm-up of a stage progresses.
+class UsdMayaStageWarmUpNotice : public TfNotice
+{
+public:
+    MAYAUSD_CORE_PUBLIC
+    UsdMayaStageWarmUpNotice(
+            const UsdStageWeakPtr& stage,
+            size_t processedPrimCount,
+            size_t primCount);
+
+    MAYAUSD_CORE_PUBLIC
+    const UsdStageWeakPtr& GetStage() const { return _stage; }
+
+    /// Number of imageable prims processed so far
+    MAYAUSD_CORE_PUBLIC
+    size_t GetProcessedPrimCount() const { return _processedPrimCount; }
+
+    /// Number of imageable prims of the stage
+    MAYAUSD_CORE_PUBLIC
+    size_t GetPrimCount() const { return _primCount; }
+
+    /// Return whether all the prims are processed. The last notice sent for
+    /// a cancelled warm-up isn't done.
+    MAYAUSD_CORE_PUBLIC
+    bool IsDone() const { return _processedPrimCount == _primCount; }
+
+private:
+    UsdStageWeakPtr _stage;
+    size_t          _processedPrimCount;
+    size_t          _primCount;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
@@ -42,7 +42,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MItDependencyNodes.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
@@ -1031,40 +1030,51 @@ _MergeEquivalentIndexedValues(
         return;
     }
 
+    // Values are usually referenced by many indices, so the index assigned
+    // to each value is cached: each value is only looked up in the map the
+    // first time it is referenced.
+    const T* const values = valueData->cdata();
+    std::vector<int> valueToUniqueIndex(numValues, -1);
+
     // We maintain a map of values to that value's index in our uniqueValues
     // array.
     std::unordered_map<T, size_t, _ValuesHash<T>, _ValuesEqual<T> > valuesMap;
-    VtArray<T> uniqueValues;
-    VtIntArray uniqueIndices;
+    valuesMap.reserve(numValues);
+    std::vector<T> uniqueValues;
+    uniqueValues.reserve(numValues);
+
+    const size_t numIndices = assignmentIndices->size();
+    const int* const indices = assignmentIndices->cdata();
+    VtIntArray uniqueIndices(numIndices);
+    int* const uniqueIndicesData = uniqueIndices.data();
 
-    for (int index : *assignmentIndices) {
+    for (size_t i = 0; i < numIndices; ++i) {
+        const int index = indices[i];
         if (index < 0 || static_cast<size_t>(index) >= numValues) {
             // This is an unassigned or otherwise unknown index, so just keep it.
-            uniqueIndices.push_back(index);
+            uniqueIndicesData[i] = index;
             continue;
         }
 
-        const T value = (*valueData)[index];
-
-        int uniqueIndex = -1;
-
-        auto inserted = valuesMap.insert(
-            std::pair<T, size_t>(value, uniqueValues.size()));
-        if (inserted.second) {
-            // This is a new value, so add it to the array.
-            uniqueValues.push_back(value);
-            uniqueIndex = uniqueValues.size() - 1;
-        } else {
-            // This is an existing value, so re-use the original's index.
-            uniqueIndex = inserted.first->second;
+        int& uniqueIndex = valueToUniqueIndex[index];
+        if (uniqueIndex < 0) {
+            auto inserted = valuesMap.insert(
+                std::pair<T, size_t>(values[index], uniqueValues.size()));
+            if (inserted.second) {
+                // This is a new value, so add it to the array.
+                uniqueValues.push_back(values[index]);
+            }
+            // Otherwise, this is an existing value, so re-use the original's
+            // index.
+            uniqueIndex = static_cast<int>(inserted.first->second);
         }
 
-        uniqueIndices.push_back(uniqueIndex);
+        uniqueIndicesData[i] = uniqueIndex;
     }
 
     // If we reduced the number of values by merging, copy the results back.
     if (uniqueValues.size() < numValues) {
-        (*valueData) = uniqueValues;
+        valueData->assign(uniqueValues.begin(), uniqueValues.end());
         (*assignmentIndices) = uniqueIndices;
     }
 }
@@ -1109,58 +1119,98 @@ UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
         return;
     }
 
+    // Fetch the face vertices of the mesh in bulk rather than walking them
+    // with an iterator.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!mesh.getVertices(faceVertexCounts, faceVertexIndices)) {
+        return;
+    }
+
+    CompressFaceVaryingPrimvarIndices(
+        faceVertexCounts, faceVertexIndices, mesh.numVertices(),
+        interpolation, assignmentIndices);
+}
+
+void
+UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
+        const MIntArray& faceVertexCounts,
+        const MIntArray& faceVertexIndices,
+        int numVertices,
+        TfToken* interpolation,
+        VtIntArray* assignmentIndices)
+{
+    if (!interpolation ||
+            !assignmentIndices ||
+            assignmentIndices->size() == 0u) {
+        return;
+    }
+
+    const unsigned int numFaceVertices = faceVertexIndices.length();
+    if (assignmentIndices->size() != numFaceVertices) {
+        TF_CODING_ERROR("Unequal sizes for assignment indices (%zu) and "
+                        "face vertices (%u)",
+                        assignmentIndices->size(), numFaceVertices);
+        return;
+    }
+
     // Use -2 as the initial "un-stored" sentinel value, since -1 is the
     // default unauthored value index for primvars.
-    int numPolygons = mesh.numPolygons();
+    const unsigned int numPolygons = faceVertexCounts.length();
     VtIntArray uniformAssignments;
     uniformAssignments.assign((size_t)numPolygons, -2);
 
-    int numVertices = mesh.numVertices();
     VtIntArray vertexAssignments;
     vertexAssignments.assign((size_t)numVertices, -2);
 
     // We assume that the data is constant/uniform/vertex until we can
-    // prove otherwise that two components have differing values.
+    // prove otherwise that two components have differing values. All three
+    // are checked in a single pass over the face vertices.
     bool isConstant = true;
     bool isUniform = true;
     bool isVertex = true;
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int faceIndex = itFV.faceId();
-        int vertexIndex = itFV.vertId();
-
-        int assignedIndex = (*assignmentIndices)[fvi];
+    const int* const assignedIndices = assignmentIndices->cdata();
+    int* const uniformData = uniformAssignments.data();
+    int* const vertexData = vertexAssignments.data();
+    const int firstAssignedIndex = assignedIndices[0];
 
-        if (isConstant) {
-            if (assignedIndex != (*assignmentIndices)[0]) {
-                isConstant = false;
+    unsigned int fvi = 0;
+    for (unsigned int faceIndex = 0;
+            faceIndex < numPolygons && (isConstant || isUniform || isVertex);
+            ++faceIndex) {
+        const int faceVertexCount = faceVertexCounts[faceIndex];
+        for (int v = 0; v < faceVertexCount; ++v, ++fvi) {
+            const int vertexIndex = faceVertexIndices[fvi];
+            const int assignedIndex = assignedIndices[fvi];
+
+            isConstant = isConstant && (assignedIndex == firstAssignedIndex);
+
+            if (isUniform) {
+                if (uniformData[faceIndex] < -1) {
+                    // No value for this face yet, so store one.
+                    uniformData[faceIndex] = assignedIndex;
+                } else if (assignedIndex != uniformData[faceIndex]) {
+                    isUniform = false;
+                }
             }
-        }
 
-        if (isUniform) {
-            if (uniformAssignments[faceIndex] < -1) {
-                // No value for this face yet, so store one.
-                uniformAssignments[faceIndex] = assignedIndex;
-            } else if (assignedIndex != uniformAssignments[faceIndex]) {
-                isUniform = false;
+            if (isVertex) {
+                if (vertexIndex < 0 || vertexIndex >= numVertices) {
+                    isVertex = false;
+                } else if (vertexData[vertexIndex] < -1) {
+                    // No value for this vertex yet, so store one.
+                    vertexData[vertexIndex] = assignedIndex;
+                } else if (assignedIndex != vertexData[vertexIndex]) {
+                    isVertex = false;
+                }
             }
-        }
 
-        if (isVertex) {
-            if (vertexAssignments[vertexIndex] < -1) {
-                // No value for this vertex yet, so store one.
-                vertexAssignments[vertexIndex] = assignedIndex;
-            } else if (assignedIndex != vertexAssignments[vertexIndex]) {
-                isVertex = false;
+            if (!isConstant && !isUniform && !isVertex) {
+                // No compression will be possible, so stop trying.
+                break;
             }
         }
-
-        if (!isConstant && !isUniform && !isVertex) {
-            // No compression will be possible, so stop trying.
-            break;
-        }
     }
 
     if (isConstant) {
@@ -32,6 +32,7 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MFnMesh.h>
 #include <maya/MFnNumericData.h>
+#include <maya/MIntArray.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
 #include <maya/MObjectHandle.h>
@@ -363,6 +364,18 @@ void CompressFaceVaryingPrimvarIndices(
         PXR_NS::TfToken* interpolation,
         PXR_NS::VtIntArray* assignmentIndices);
 
+/// Attempt to compress faceVarying primvar indices to uniform, vertex, or
+/// constant interpolation if possible, using the face vertices of a mesh
+/// already fetched with MFnMesh::getVertices(). This avoids fetching them
+/// again when compressing several primvars of the same mesh.
+MAYAUSD_CORE_PUBLIC
+void CompressFaceVaryingPrimvarIndices(
+        const MIntArray& faceVertexCounts,
+        const MIntArray& faceVertexIndices,
+        int numVertices,
+        PXR_NS::TfToken* interpolation,
+        PXR_NS::VtIntArray* assignmentIndices);
+
 /// Get whether \p plug is authored in the Maya scene.
 ///
 /// A plug is considered authored if its value has been changed from the
@@ -45,6 +45,11 @@
 #include <pxr/imaging/hdSt/textureResourceHandle.h>
 #endif
 
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -250,15 +255,11 @@ public:
 
     HdMayaShadingEngineAdapter(
         const SdfPath& id, HdMayaDelegateCtx* delegate, const MObject& obj)
-        : HdMayaMaterialAdapter(id, delegate, obj), _surfaceShaderCallback(0) {
+        : HdMayaMaterialAdapter(id, delegate, obj) {
         _CacheNodeAndTypes();
     }
 
-    ~HdMayaShadingEngineAdapter() override {
-        if (_surfaceShaderCallback != 0) {
-            MNodeMessage::removeCallback(_surfaceShaderCallback);
-        }
-    }
+    ~HdMayaShadingEngineAdapter() override { _RemoveNetworkNodeCallbacks(); }
 
     void CreateCallbacks() override {
         TF_DEBUG(HDMAYA_ADAPTER_CALLBACKS)
@@ -266,12 +267,14 @@ public:
                 "Creating shading engine adapter callbacks for prim (%s).\n",
                 GetID().GetText());
 
+        // Dirty propagation reaches the shading engine for every change of
+        // the shading network, only a new surface shader connection requires
+        // converting the network again.
         MStatus status;
         auto obj = GetNode();
-        auto id = MNodeMessage::addNodeDirtyCallback(
-            obj, _DirtyMaterialParams, this, &status);
+        auto id = MNodeMessage::addAttributeChangedCallback(
+            obj, _ShadingEngineAttributeChanged, this, &status);
         if (ARCH_LIKELY(status)) { AddCallback(id); }
-        _CreateSurfaceMaterialCallback();
         HdMayaAdapter::CreateCallbacks();
     }
 
@@ -283,22 +286,146 @@ public:
     }
 
 private:
-    static void _DirtyMaterialParams(MObject& /*node*/, void* clientData) {
+    struct _NetworkNodeCallbackData {
+        HdMayaShadingEngineAdapter* adapter;
+        SdfPath path;
+    };
+
+    static void _ShadingEngineAttributeChanged(
+        MNodeMessage::AttributeMessage msg, MPlug& plug, MPlug& /*otherPlug*/,
+        void* clientData) {
+        if (!(msg & (MNodeMessage::kConnectionMade |
+                     MNodeMessage::kConnectionBroken)) ||
+            plug.attribute() != MayaAttrs::shadingEngine::surfaceShader) {
+            return;
+        }
         auto* adapter =
             reinterpret_cast<HdMayaShadingEngineAdapter*>(clientData);
-        adapter->_CreateSurfaceMaterialCallback();
-        adapter->MarkDirty(HdMaterial::AllDirty);
+        adapter->_CacheNodeAndTypes();
+        adapter->_DirtyMaterialNetwork();
     }
 
-    static void _DirtyShaderParams(MObject& /*node*/, void* clientData) {
-        auto* adapter =
-            reinterpret_cast<HdMayaShadingEngineAdapter*>(clientData);
-        adapter->MarkDirty(HdMaterial::AllDirty);
-        if (adapter->GetDelegate()->IsHdSt()) {
-            adapter->GetDelegate()->MaterialTagChanged(adapter->GetID());
+    static void _NetworkNodeAttributeChanged(
+        MNodeMessage::AttributeMessage msg, MPlug& /*plug*/,
+        MPlug& /*otherPlug*/, void* clientData) {
+        if (msg & (MNodeMessage::kConnectionMade |
+                   MNodeMessage::kConnectionBroken)) {
+            auto* data = reinterpret_cast<_NetworkNodeCallbackData*>(clientData);
+            data->adapter->_DirtyMaterialNetwork();
+        }
+    }
+
+    static void _DirtyNetworkNodePlug(
+        MObject& /*node*/, MPlug& plug, void* clientData) {
+        auto* data = reinterpret_cast<_NetworkNodeCallbackData*>(clientData);
+        data->adapter->_DirtyMaterialParams(data->path, plug);
+    }
+
+    void _DirtyMaterialNetwork() {
+        _materialNetworkDirty = true;
+        _dirtyParamPlugs.clear();
+        MarkDirty(HdMaterial::AllDirty);
+        if (GetDelegate()->IsHdSt()) {
+            GetDelegate()->MaterialTagChanged(GetID());
+        }
+    }
+
+    /// Records a dirty plug of a network node. Plug values can't be read
+    /// from a dirty plug callback, the parameters driven by the plug are
+    /// patched when the material is synced.
+    void _DirtyMaterialParams(const SdfPath& path, const MPlug& plug) {
+        if (_materialNetworkDirty) { return; }
+
+        auto& plugs = _dirtyParamPlugs[path];
+        if (std::find(plugs.begin(), plugs.end(), plug) != plugs.end()) {
+            return;
+        }
+        plugs.push_back(plug);
+
+        // Parameter values reach Storm through the material resource past
+        // 19.11, which is served from the patched network.
+#if USD_VERSION_NUM > 1911
+        MarkDirty(HdMaterial::DirtyParams | HdMaterial::DirtyResource);
+#else
+        MarkDirty(HdMaterial::DirtyParams);
+#endif
+        if (GetDelegate()->IsHdSt()) {
+            GetDelegate()->MaterialTagChanged(GetID());
         }
     }
 
+    /// Converts the network again if a connection changed, otherwise patches
+    /// the parameters of the converted network driven by the plugs dirtied
+    /// since the last sync, so that editing a value doesn't convert the
+    /// whole network again.
+    void _UpdateMaterialNetwork() {
+        if (_materialNetworkDirty) {
+            _RebuildMaterialNetwork();
+            return;
+        }
+
+        for (const auto& it : _dirtyParamPlugs) {
+            const auto nodeIt = _materialNodeIndices.find(it.first);
+            const auto mobjIt = _materialPathToMobj.find(it.first);
+            if (nodeIt == _materialNodeIndices.end() ||
+                nodeIt->second >= _materialNetwork.nodes.size() ||
+                mobjIt == _materialPathToMobj.end()) {
+                _RebuildMaterialNetwork();
+                return;
+            }
+
+            // Output plugs get dirty along with the inputs, they don't drive
+            // any parameter and are skipped by UpdateParameters.
+            for (const auto& plug : it.second) {
+                HdMayaMaterialNetworkConverter::UpdateParameters(
+                    mobjIt->second, _materialNetwork.nodes[nodeIt->second],
+                    plug);
+            }
+        }
+        _dirtyParamPlugs.clear();
+    }
+
+    void _RebuildMaterialNetwork() {
+        TF_DEBUG(HDMAYA_ADAPTER_MATERIALS)
+            .Msg(
+                "HdMayaShadingEngineAdapter::_RebuildMaterialNetwork(): %s\n",
+                GetID().GetText());
+        _RemoveNetworkNodeCallbacks();
+        _materialNetwork = HdMaterialNetwork();
+        _materialPathToMobj.clear();
+        _materialNodeIndices.clear();
+        HdMayaMaterialNetworkConverter converter(
+            _materialNetwork, GetID(), &_materialPathToMobj,
+            &_materialNodeIndices);
+        _materialNetworkValid = converter.GetMaterial(_surfaceShader) != nullptr;
+        _materialNetworkDirty = false;
+        _dirtyParamPlugs.clear();
+        _CreateNetworkNodeCallbacks();
+    }
+
+    void _CreateNetworkNodeCallbacks() {
+        for (const auto& it : _materialPathToMobj) {
+            MObject obj = it.second;
+            _networkNodeCallbackData.emplace_back(
+                new _NetworkNodeCallbackData{this, it.first});
+            auto* data = _networkNodeCallbackData.back().get();
+
+            MStatus status;
+            auto id = MNodeMessage::addNodeDirtyPlugCallback(
+                obj, _DirtyNetworkNodePlug, data, &status);
+            if (ARCH_LIKELY(status)) { _networkNodeCallbacks.push_back(id); }
+            id = MNodeMessage::addAttributeChangedCallback(
+                obj, _NetworkNodeAttributeChanged, data, &status);
+            if (ARCH_LIKELY(status)) { _networkNodeCallbacks.push_back(id); }
+        }
+    }
+
+    void _RemoveNetworkNodeCallbacks() {
+        for (auto c : _networkNodeCallbacks) { MNodeMessage::removeCallback(c); }
+        _networkNodeCallbacks.clear();
+        _networkNodeCallbackData.clear();
+    }
+
     void _CacheNodeAndTypes() {
         _surfaceShader = MObject::kNullObj;
         _surfaceShaderType = _emptyToken;
@@ -441,6 +568,10 @@ private:
     }
 
     HdMaterialParamVector GetMaterialParams() override {
+        // Params are read from the Maya nodes directly here, the network is
+        // kept up to date to track the nodes to register callbacks on.
+        _UpdateMaterialNetwork();
+
         MStatus status;
         MFnDependencyNode node(_surfaceShader, &status);
         if (ARCH_UNLIKELY(!status)) { return GetPreviewMaterialParams(); }
@@ -586,19 +717,6 @@ private:
 
 #endif // USD_VERSION_NUM <= 1911
 
-    void _CreateSurfaceMaterialCallback() {
-        _CacheNodeAndTypes();
-        if (_surfaceShaderCallback != 0) {
-            MNodeMessage::removeCallback(_surfaceShaderCallback);
-            _surfaceShaderCallback = 0;
-        }
-
-        if (_surfaceShader != MObject::kNullObj) {
-            _surfaceShaderCallback = MNodeMessage::addNodeDirtyCallback(
-                _surfaceShader, _DirtyShaderParams, this);
-        }
-    }
-
     inline HdTextureResource::ID _GetTextureResourceID(
         const MObject& fileObj, const TfToken& filePath) {
         auto hash = filePath.Hash();
@@ -614,22 +732,23 @@ private:
         TF_DEBUG(HDMAYA_ADAPTER_MATERIALS)
             .Msg("HdMayaShadingEngineAdapter::GetMaterialResource(): %s\n",
                     GetID().GetText());
-        HdMaterialNetwork materialNetwork;
-        HdMayaMaterialNetworkConverter converter(materialNetwork, GetID(),
-                &_materialPathToMobj);
-        if (!converter.GetMaterial(_surfaceShader)) {
+        // The network is kept between syncs, value edits patch it in place
+        // and only connection changes convert it again.
+        _UpdateMaterialNetwork();
+        if (!_materialNetworkValid) {
             return GetPreviewMaterialResource(GetID());
         }
 
         HdMaterialNetworkMap materialNetworkMap;
 #if USD_VERSION_NUM >= 1911
-        materialNetworkMap.map[HdMaterialTerminalTokens->surface] = materialNetwork;
-        if (!materialNetwork.nodes.empty()) {
+        materialNetworkMap.map[HdMaterialTerminalTokens->surface] =
+            _materialNetwork;
+        if (!_materialNetwork.nodes.empty()) {
             materialNetworkMap.terminals.push_back(
-                materialNetwork.nodes.back().path);
+                _materialNetwork.nodes.back().path);
         }
 #else
-        materialNetworkMap.map[UsdImagingTokens->bxdf] = materialNetwork;
+        materialNetworkMap.map[UsdImagingTokens->bxdf] = _materialNetwork;
 #endif
         // HdMaterialNetwork displacementNetwork;
         // materialNetworkMap.map[HdMaterialTerminalTokens->displacement] =
@@ -673,7 +792,17 @@ private:
 
 #endif // HDMAYA_OIT_ENABLED
 
+    typedef HdMayaMaterialNetworkConverter::PathToNodeIndexMap
+        PathToNodeIndexMap;
+
+    HdMaterialNetwork _materialNetwork;
     PathToMobjMap _materialPathToMobj;
+    PathToNodeIndexMap _materialNodeIndices;
+    std::unordered_map<SdfPath, std::vector<MPlug>, SdfPath::Hash>
+        _dirtyParamPlugs;
+    std::vector<std::unique_ptr<_NetworkNodeCallbackData>>
+        _networkNodeCallbackData;
+    std::vector<MCallbackId> _networkNodeCallbacks;
 
     MObject _surfaceShader;
     TfToken _surfaceShaderType;
@@ -688,7 +817,8 @@ private:
         TfToken, HdTextureResourceSharedPtr, TfToken::HashFunctor>
         _textureResources;
 #endif
-    MCallbackId _surfaceShaderCallback;
+    bool _materialNetworkDirty = true;
+    bool _materialNetworkValid = false;
 #ifdef HDMAYA_OIT_ENABLED
     bool _isTranslucent = false;
 #endif
@@ -504,8 +504,17 @@ HdMayaShaderParam::HdMayaShaderParam(
 
 HdMayaMaterialNetworkConverter::HdMayaMaterialNetworkConverter(
     HdMaterialNetwork& network, const SdfPath& prefix,
-    PathToMobjMap* pathToMobj)
-    : _network(network), _prefix(prefix), _pathToMobj(pathToMobj) {}
+    PathToMobjMap* pathToMobj, PathToNodeIndexMap* pathToNodeIndex)
+    : _network(network),
+      _prefix(prefix),
+      _pathToMobj(pathToMobj),
+      _pathToNodeIndex(
+          pathToNodeIndex ? pathToNodeIndex : &_ownPathToNodeIndex) {
+    // Index the nodes already in the network, if any.
+    for (size_t i = 0; i < _network.nodes.size(); ++i) {
+        _pathToNodeIndex->emplace(_network.nodes[i].path, i);
+    }
+}
 
 HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
     const MObject& mayaNode) {
@@ -519,12 +528,10 @@ HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
     std::string usdNameStr = UsdMayaUtil::SanitizeName(chr);
     const auto materialPath = _prefix.AppendChild(TfToken(usdNameStr));
 
-    auto findResult = std::find_if(
-            _network.nodes.begin(), _network.nodes.end(),
-            [&materialPath](const HdMaterialNode& m) -> bool {
-                return m.path == materialPath;
-        });
-    if (findResult != _network.nodes.end()) { return &(*findResult); }
+    auto findResult = _pathToNodeIndex->find(materialPath);
+    if (findResult != _pathToNodeIndex->end()) {
+        return &_network.nodes[findResult->second];
+    }
 
     auto* nodeConverter = HdMayaMaterialNodeConverter::GetNodeConverter(
         TfToken(node.typeName().asChar()));
@@ -573,10 +580,71 @@ HdMaterialNode* HdMayaMaterialNetworkConverter::GetMaterial(
         }
     }
     if(_pathToMobj) { (*_pathToMobj)[materialPath] = mayaNode; }
+    (*_pathToNodeIndex)[materialPath] = _network.nodes.size();
     _network.nodes.push_back(material);
     return &_network.nodes.back();
 }
 
+bool HdMayaMaterialNetworkConverter::UpdateParameters(
+    const MObject& mayaNode, HdMaterialNode& material, const MPlug& plug) {
+    MStatus status;
+    MFnDependencyNode node(mayaNode, &status);
+    if (ARCH_UNLIKELY(!status)) { return false; }
+
+    auto* nodeConverter = HdMayaMaterialNodeConverter::GetNodeConverter(
+        TfToken(node.typeName().asChar()));
+    if (!nodeConverter) { return false; }
+
+    // Plugs of compound and array attributes are reported per child or
+    // element, while parameters are mapped to the top level attribute.
+    MPlug topPlug = plug;
+    while (topPlug.isChild()) { topPlug = topPlug.parent(); }
+    if (topPlug.isElement()) { topPlug = topPlug.array(); }
+    const MObject attr = topPlug.attribute();
+
+    TF_DEBUG(HDMAYA_ADAPTER_MATERIALS)
+        .Msg(
+            "HdMayaMaterialNetworkConverter::UpdateParameters(node=%s, "
+            "plug=%s)\n",
+            node.name().asChar(), topPlug.partialName().asChar());
+
+    bool updated = false;
+    auto updateParameter = [&](const TfToken& paramName,
+                               const SdfValueTypeName& type,
+                               const VtValue* fallback) {
+        auto attrConverter = nodeConverter->GetAttrConverter(paramName);
+        if (!attrConverter) { return; }
+        const TfToken plugName = attrConverter->GetPlugName(paramName);
+        if (!plugName.IsEmpty() &&
+            node.attribute(plugName.GetText()) != attr) {
+            return;
+        }
+        material.parameters[paramName] =
+            attrConverter->GetValue(node, paramName, type, fallback);
+        updated = true;
+    };
+
+    if (material.identifier == UsdImagingTokens->UsdPreviewSurface) {
+        for (const auto& param :
+             HdMayaMaterialNetworkConverter::GetPreviewShaderParams()) {
+#if USD_VERSION_NUM >= 1911
+            updateParameter(param.name, param.type, &param.fallbackValue);
+#else
+            updateParameter(
+                param.param.GetName(), param.type,
+                &param.param.GetFallbackValue());
+#endif
+        }
+    } else {
+        for (auto& nameAttrConverterPair : nodeConverter->GetAttrConverters()) {
+            updateParameter(
+                nameAttrConverterPair.first,
+                nameAttrConverterPair.second->GetType(), nullptr);
+        }
+    }
+    return updated;
+}
+
 void HdMayaMaterialNetworkConverter::AddPrimvar(const TfToken& primvar) {
     if (std::find(
             _network.primvars.begin(), _network.primvars.end(), primvar) ==
@@ -123,15 +123,31 @@ private:
 class HdMayaMaterialNetworkConverter {
 public:
     typedef std::unordered_map<SdfPath, MObject, SdfPath::Hash> PathToMobjMap;
+    typedef std::unordered_map<SdfPath, size_t, SdfPath::Hash>
+        PathToNodeIndexMap;
 
+    /// The optional \p pathToNodeIndex map is filled with the index in
+    /// \p network of each converted node. It lets callers keep the network
+    /// around and find its nodes again to update their parameters.
     HDMAYA_API
     HdMayaMaterialNetworkConverter(
         HdMaterialNetwork& network, const SdfPath& prefix,
-        PathToMobjMap* pathToMobj = nullptr);
+        PathToMobjMap* pathToMobj = nullptr,
+        PathToNodeIndexMap* pathToNodeIndex = nullptr);
 
     HDMAYA_API
     HdMaterialNode* GetMaterial(const MObject& mayaNode);
 
+    /// Recomputes the values of the parameters of \p material, previously
+    /// converted from \p mayaNode, which are driven by \p plug. Parameters
+    /// whose value isn't read directly from a plug are always recomputed.
+    /// Connections are left untouched, the network has to be converted
+    /// again when they change.
+    /// Returns true if any parameter was recomputed.
+    HDMAYA_API
+    static bool UpdateParameters(
+        const MObject& mayaNode, HdMaterialNode& material, const MPlug& plug);
+
     HDMAYA_API
     void AddPrimvar(const TfToken& primvar);
 
@@ -168,6 +184,8 @@ private:
     HdMaterialNetwork& _network;
     const SdfPath& _prefix;
     PathToMobjMap* _pathToMobj;
+    PathToNodeIndexMap _ownPathToNodeIndex;
+    PathToNodeIndexMap* _pathToNodeIndex;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -15,6 +15,8 @@
 //
 #include "instancerWriter.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include <maya/MAnimUtil.h>
@@ -24,14 +26,19 @@
 #include <maya/MFnDependencyNode.h>
 #include <maya/MMatrix.h>
 
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
 #include <pxr/base/gf/vec3d.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/kind/registry.h>
 #include <pxr/usd/usd/modelAPI.h>
 #include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
+#include <pxr/usd/usdGeom/tokens.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 #include <pxr/usd/usdGeom/xformOp.h>
 
@@ -57,6 +64,10 @@ namespace {
 
 static constexpr double _EPSILON = 1e-3;
 
+/// Number of instances whose bounds are accumulated by each task of the
+/// parallel extent computation.
+static constexpr size_t _EXTENT_GRAIN_SIZE = 4096;
+
 /// Determines if the second translate op encodes the exact negation of the
 /// first op, across default values and time samples.
 static
@@ -164,6 +175,29 @@ _GetTransformedOriginInLocalSpace(
     return false;
 }
 
+/// Returns the axis-aligned range enclosing \p range transformed by the affine
+/// matrix \p xform. This gives the same result as transforming the eight
+/// corners of the range, using the center and half size of the range instead.
+static
+GfRange3d
+_TransformRange(const GfRange3d& range, const GfMatrix4d& xform)
+{
+    if (range.IsEmpty()) {
+        return range;
+    }
+
+    const GfVec3d center = xform.Transform(range.GetMidpoint());
+    const GfVec3d halfSize = range.GetSize() * 0.5;
+    GfVec3d halfExtent;
+    for (int j = 0; j < 3; ++j) {
+        halfExtent[j] =
+                std::fabs(xform[0][j]) * halfSize[0] +
+                std::fabs(xform[1][j]) * halfSize[1] +
+                std::fabs(xform[2][j]) * halfSize[2];
+    }
+    return GfRange3d(center - halfExtent, center + halfExtent);
+}
+
 } // anonymous namespace
 
 PxrUsdTranslators_InstancerWriter::PxrUsdTranslators_InstancerWriter(
@@ -171,7 +205,8 @@ PxrUsdTranslators_InstancerWriter::PxrUsdTranslators_InstancerWriter(
         const SdfPath& usdPath,
         UsdMayaWriteJobContext& jobCtx) :
     UsdMayaTransformWriter(depNodeFn, usdPath, jobCtx),
-    _numPrototypes(0)
+    _numPrototypes(0),
+    _prototypesAnimated(false)
 {
     if (!TF_VERIFY(GetDagPath().isValid())) {
         return;
@@ -343,6 +378,17 @@ PxrUsdTranslators_InstancerWriter::writeInstancerAttrs(
         }
 
         _numPrototypes = numElements;
+
+        // The prototype bounds only need to be computed again at each time
+        // sample if some of the prototypes are animated.
+        _prototypeBounds.clear();
+        _prototypesAnimated = false;
+        for (const UsdMayaPrimWriterSharedPtr& writer : _prototypeWriters) {
+            _prototypesAnimated |= writer->IsAnimated();
+        }
+        for (const _TranslateOpData& opData : _instancerTranslateOps) {
+            _prototypesAnimated |= opData.isAnimated;
+        }
     }
 
     // If there aren't any prototypes, fail and don't export on subsequent
@@ -420,13 +466,111 @@ PxrUsdTranslators_InstancerWriter::writeInstancerAttrs(
     // Load the completed point instancer to compute and set its extent.
     instancer.GetPrim().GetStage()->Load(instancer.GetPath());
     VtArray<GfVec3f> extent(2);
-    if (instancer.ComputeExtentAtTime(&extent, usdTime, usdTime)) {
+    if (_ComputeExtentAtTime(instancer, usdTime, &extent)) {
         UsdMayaWriteUtil::SetAttribute(instancer.CreateExtentAttr(), &extent, usdTime, _GetSparseValueWriter());
     }
 
     return true;
 }
 
+/// Computes the extent of the instancer in the same way as
+/// UsdGeomPointInstancer::ComputeExtentAtTime(), but reusing the bounds of the
+/// prototypes across time samples when they aren't animated, and accumulating
+/// the bounds of the instances in parallel.
+bool
+PxrUsdTranslators_InstancerWriter::_ComputeExtentAtTime(
+        const UsdGeomPointInstancer& instancer,
+        const UsdTimeCode& usdTime,
+        VtVec3fArray* extent)
+{
+    if (_prototypeBounds.empty() || _prototypesAnimated) {
+        SdfPathVector prototypePaths;
+        instancer.GetPrototypesRel().GetTargets(&prototypePaths);
+
+        UsdGeomBBoxCache bboxCache(
+                usdTime,
+                { UsdGeomTokens->default_,
+                  UsdGeomTokens->proxy,
+                  UsdGeomTokens->render });
+
+        _prototypeBounds.clear();
+        _prototypeBounds.reserve(prototypePaths.size());
+        for (const SdfPath& prototypePath : prototypePaths) {
+            const UsdPrim prototypePrim =
+                    GetUsdStage()->GetPrimAtPath(prototypePath);
+            if (!prototypePrim) {
+                _prototypeBounds.clear();
+                return false;
+            }
+            _prototypeBounds.push_back(bboxCache.ComputeRelativeBound(
+                    prototypePrim, instancer.GetPrim()));
+        }
+    }
+
+    VtIntArray protoIndices;
+    if (!instancer.GetProtoIndicesAttr().Get(&protoIndices, usdTime)) {
+        return false;
+    }
+
+    // The bounds computed above already contain the prototype transforms.
+    VtArray<GfMatrix4d> instanceTransforms;
+    if (!instancer.ComputeInstanceTransformsAtTime(
+            &instanceTransforms,
+            usdTime,
+            usdTime,
+            UsdGeomPointInstancer::ExcludeProtoXform,
+            UsdGeomPointInstancer::IgnoreMask)) {
+        return false;
+    }
+
+    const size_t numInstances = instanceTransforms.size();
+    if (protoIndices.size() != numInstances) {
+        return false;
+    }
+    const std::vector<bool> mask = instancer.ComputeMaskAtTime(usdTime);
+
+    const size_t numChunks =
+            (numInstances + _EXTENT_GRAIN_SIZE - 1) / _EXTENT_GRAIN_SIZE;
+    std::vector<GfRange3d> chunkRanges(numChunks);
+    WorkParallelForN(
+        numChunks,
+        [&](size_t begin, size_t end) {
+            for (size_t chunk = begin; chunk < end; ++chunk) {
+                GfRange3d& chunkRange = chunkRanges[chunk];
+                const size_t first = chunk * _EXTENT_GRAIN_SIZE;
+                const size_t last = std::min(
+                        numInstances, first + _EXTENT_GRAIN_SIZE);
+                for (size_t i = first; i < last; ++i) {
+                    if (!mask.empty() && !mask[i]) {
+                        continue;
+                    }
+
+                    const int protoIndex = protoIndices[i];
+                    if (protoIndex < 0 ||
+                            static_cast<size_t>(protoIndex) >=
+                                _prototypeBounds.size()) {
+                        continue;
+                    }
+
+                    const GfBBox3d& bounds = _prototypeBounds[protoIndex];
+                    chunkRange.UnionWith(_TransformRange(
+                            bounds.GetRange(),
+                            bounds.GetMatrix() * instanceTransforms[i]));
+                }
+            }
+        });
+
+    GfRange3d range;
+    for (const GfRange3d& chunkRange : chunkRanges) {
+        range.UnionWith(chunkRange);
+    }
+
+    extent->resize(2);
+    (*extent)[0] = GfVec3f(range.GetMin());
+    (*extent)[1] = GfVec3f(range.GetMax());
+    return true;
+}
+
 /* virtual */
 void
 PxrUsdTranslators_InstancerWriter::PostExport()
@@ -452,6 +596,15 @@ PxrUsdTranslators_InstancerWriter::ShouldPruneChildren() const
     return true;
 }
 
+/* virtual */
+bool
+PxrUsdTranslators_InstancerWriter::IsAnimated() const
+{
+    // Instancer data is driven by particles and the prototypes' animation,
+    // neither of which is reliably reported by the DG history of the node.
+    return true;
+}
+
 /* virtual */
 const SdfPathVector&
 PxrUsdTranslators_InstancerWriter::GetModelPaths() const
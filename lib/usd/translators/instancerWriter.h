@@ -24,6 +24,8 @@
 #include <maya/MFnDependencyNode.h>
 
 #include <pxr/pxr.h>
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/usd/sdf/path.h>
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
@@ -58,6 +60,7 @@ public:
     void Write(const UsdTimeCode& usdTime) override;
     void PostExport() override;
     bool ShouldPruneChildren() const override;
+    bool IsAnimated() const override;
     const SdfPathVector& GetModelPaths() const override;
 
 protected:
@@ -70,6 +73,11 @@ private:
             const MDagPath& prototypeDagPath,
             bool* instancerTranslateAnimated) const;
 
+    bool _ComputeExtentAtTime(
+            const UsdGeomPointInstancer& instancer,
+            const UsdTimeCode& usdTime,
+            VtVec3fArray* extent);
+
     /// Used internally by PxrUsdTranslators_InstancerWriter to keep track of the
     /// instancerTranslate xformOp for compensating Maya's instancer position
     /// behavior.
@@ -89,6 +97,11 @@ private:
     std::vector<_TranslateOpData> _instancerTranslateOps;
     /// Cached list of model paths for point instancer.
     SdfPathVector _modelPaths;
+    /// Bounds of each prototype relative to the instancer. They are computed
+    /// once and reused at every time sample, unless the prototypes are
+    /// animated.
+    std::vector<GfBBox3d> _prototypeBounds;
+    bool _prototypesAnimated;
 };
 
 
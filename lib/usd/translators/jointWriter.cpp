@@ -622,5 +622,19 @@ PxrUsdTranslators_JointWriter::ShouldPruneChildren() const
     return true;
 }
 
+/* virtual */
+bool
+PxrUsdTranslators_JointWriter::IsAnimated() const
+{
+    // The skeleton writer handles the animation of the whole joint hierarchy
+    // below it, so it cannot be culled based on the root joint alone.
+    if (!_valid) {
+        return false;
+    }
+
+    return (_skelXformAttr && _skelXformIsAnimated) ||
+        !_animatedJoints.empty();
+}
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -57,6 +57,7 @@ public:
     void Write(const UsdTimeCode& usdTime) override;
     bool ExportsGprims() const override;
     bool ShouldPruneChildren() const override;
+    bool IsAnimated() const override;
 
 private:
     bool _WriteRestState();
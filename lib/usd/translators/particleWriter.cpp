@@ -222,6 +222,15 @@ PxrUsdTranslators_ParticleWriter::Write(const UsdTimeCode& usdTime)
     writeParams(usdTime, primSchema);
 }
 
+/* virtual */
+bool
+PxrUsdTranslators_ParticleWriter::IsAnimated() const
+{
+    // Particles are only written at time samples (see writeParams()), so
+    // they always need to be visited.
+    return true;
+}
+
 void
 PxrUsdTranslators_ParticleWriter::writeParams(
         const UsdTimeCode& usdTime,
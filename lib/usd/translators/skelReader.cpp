@@ -19,6 +19,7 @@
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/primRange.h>
 #include <pxr/usd/usdGeom/xform.h>
+#include <pxr/usd/usdSkel/binding.h>
 #include <pxr/usd/usdSkel/cache.h>
 #include <pxr/usd/usdSkel/root.h>
 #include <pxr/usd/usdSkel/skeletonQuery.h>
@@ -180,7 +181,16 @@ UsdMayaPrimReaderSkelRoot::PostReadSubtree(
     }
 #endif
 
-    for (const UsdSkelBinding& binding : bindings) {
+    // Compute the joint influences of all skinned prims in parallel up front,
+    // so that only the creation of the skin clusters runs serially.
+    std::vector<std::vector<UsdMayaTranslatorSkel::SkinClusterWeights>>
+        skinClusterWeights;
+    UsdMayaTranslatorSkel::ComputeSkinClusterWeights(
+        _cache, bindings, _GetArgs(), &skinClusterWeights);
+
+    for (size_t bindingIndex = 0; bindingIndex < bindings.size();
+            ++bindingIndex) {
+        const UsdSkelBinding& binding = bindings[bindingIndex];
         if (binding.GetSkinningTargets().empty())
             continue;
 
@@ -193,8 +203,12 @@ UsdMayaPrimReaderSkelRoot::PostReadSubtree(
                 continue;
             }
             
-            for (const auto& skinningQuery : binding.GetSkinningTargets()) {
+            for (size_t targetIndex = 0;
+                    targetIndex < binding.GetSkinningTargets().size();
+                    ++targetIndex) {
 
+                const UsdSkelSkinningQuery& skinningQuery =
+                    binding.GetSkinningTargets()[targetIndex];
                 const UsdPrim& skinnedPrim = skinningQuery.GetPrim();
 
                 // Get an ordering of the joints that matches the ordering of
@@ -233,7 +247,12 @@ UsdMayaPrimReaderSkelRoot::PostReadSubtree(
                 // Add a skin cluster to skin this prim.
                 UsdMayaTranslatorSkel::CreateSkinCluster(
                     skelQuery, skinningQuery, skinningJoints,
-                    skinnedPrim, _GetArgs(), context, bindPose);
+                    skinnedPrim, _GetArgs(), context, bindPose,
+                    &skinClusterWeights[bindingIndex][targetIndex]);
+
+                // Release the influences once set on the skin cluster.
+                skinClusterWeights[bindingIndex][targetIndex] =
+                    UsdMayaTranslatorSkel::SkinClusterWeights();
             }
         }
     }
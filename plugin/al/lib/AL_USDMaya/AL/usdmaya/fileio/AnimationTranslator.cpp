@@ -17,20 +17,259 @@
 #include "AL/usdmaya/fileio/AnimationTranslator.h"
 #include "AL/usdmaya/fileio/translators/DgNodeTranslator.h"
 #include "AL/usdmaya/fileio/translators/TransformTranslator.h"
+#include "AL/usdmaya/utils/AttributeType.h"
 #include "AL/usdmaya/utils/MeshUtils.h"
 
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnNumericAttribute.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
 
+#include <pxr/base/gf/half.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/gf/vec3h.h>
+
+#include <algorithm>
+#include <vector>
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
 
+namespace {
+
+using usdmaya::utils::UsdDataType;
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  A plug whose value can be computed by sampling the anim curves connected to it (or to its children),
+///         without evaluating the DG at each sample time.
+//----------------------------------------------------------------------------------------------------------------------
+struct CurveSampledPlug
+{
+  UsdAttribute m_attr;
+  UsdDataType m_type;
+  double m_scale;
+  MObject m_curves[3]; ///< the curve driving each component, null if the component isn't connected
+  double m_values[3]; ///< the value of the components which are not connected
+  uint32_t m_count;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  returns true if the value of the plug can be read as a double, i.e. it's a scalar numeric plug
+//----------------------------------------------------------------------------------------------------------------------
+bool isScalarPlug(const MPlug& plug)
+{
+  if(plug.isArray() || plug.isCompound())
+  {
+    return false;
+  }
+
+  const MObject attribute = plug.attribute();
+  switch(attribute.apiType())
+  {
+  case MFn::kDoubleLinearAttribute:
+  case MFn::kFloatLinearAttribute:
+  case MFn::kDoubleAngleAttribute:
+  case MFn::kFloatAngleAttribute:
+    return true;
+
+  case MFn::kNumericAttribute:
+    switch(MFnNumericAttribute(attribute).unitType())
+    {
+    case MFnNumericData::kBoolean:
+    case MFnNumericData::kFloat:
+    case MFnNumericData::kDouble:
+      return true;
+    default:
+      return false;
+    }
+
+  default:
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  classifies a scalar plug. The plug either isn't connected, in which case its current value is returned,
+///         or is driven directly by a time based anim curve, which is returned. Plugs driven by anything else (driven
+///         keys, expressions, constraints, anim layers, ...) need the DG to be evaluated and return false.
+//----------------------------------------------------------------------------------------------------------------------
+bool getDirectAnimCurve(const MPlug& plug, MObject& curve, double& value)
+{
+  if(!isScalarPlug(plug))
+  {
+    return false;
+  }
+
+  const MPlug source = plug.source();
+  if(source.isNull())
+  {
+    curve = MObject::kNullObj;
+    value = plug.asDouble();
+    return true;
+  }
+
+  MObject sourceNode = source.node();
+  if(!sourceNode.hasFn(MFn::kAnimCurve))
+  {
+    return false;
+  }
+
+  // curves with an input connected to anything but the time node (e.g. time warps) are evaluated at a different time
+  MFnAnimCurve fnCurve(sourceNode);
+  if(!fnCurve.isTimeInput())
+  {
+    return false;
+  }
+  const MPlug input = fnCurve.findPlug("input", true).source();
+  if(!input.isNull() && !input.node().hasFn(MFn::kTime))
+  {
+    return false;
+  }
+
+  curve = sourceNode;
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  checks whether the value of a plug can be sampled from anim curves for the given attribute type.
+/// \param  plug the maya plug
+/// \param  attr the usd attribute to write the samples into
+/// \param  scale a scale to apply to the samples
+/// \param  sampledPlug returned sampling info
+/// \return true if the plug can be sampled from anim curves
+//----------------------------------------------------------------------------------------------------------------------
+bool classifyPlug(const MPlug& plug, const UsdAttribute& attr, const double scale, CurveSampledPlug& sampledPlug)
+{
+  sampledPlug.m_attr = attr;
+  sampledPlug.m_type = usdmaya::utils::getAttributeType(attr);
+  sampledPlug.m_scale = scale;
+
+  switch(sampledPlug.m_type)
+  {
+  case UsdDataType::kBool:
+  case UsdDataType::kHalf:
+  case UsdDataType::kFloat:
+  case UsdDataType::kDouble:
+    sampledPlug.m_count = 1;
+    return getDirectAnimCurve(plug, sampledPlug.m_curves[0], sampledPlug.m_values[0]);
+
+  case UsdDataType::kVec3h:
+  case UsdDataType::kVec3f:
+  case UsdDataType::kVec3d:
+    {
+      const MFn::Type apiType = plug.attribute().apiType();
+      if(plug.isArray() || plug.numChildren() != 3 ||
+         (apiType != MFn::kAttribute3Double && apiType != MFn::kAttribute3Float))
+      {
+        return false;
+      }
+      // a connection to the compound itself drives all the children at once
+      if(plug.isDestination())
+      {
+        return false;
+      }
+      sampledPlug.m_count = 3;
+      for(uint32_t i = 0; i < 3; ++i)
+      {
+        if(!getDirectAnimCurve(plug.child(i), sampledPlug.m_curves[i], sampledPlug.m_values[i]))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  default:
+    return false;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  samples the anim curves of a plug at all the export times and writes the values into its usd attribute
+//----------------------------------------------------------------------------------------------------------------------
+void sampleAnimCurves(const CurveSampledPlug& sampledPlug, const std::vector<double>& times)
+{
+  const size_t numTimes = times.size();
+  std::vector<double> samples(numTimes * sampledPlug.m_count);
+  for(uint32_t i = 0; i < sampledPlug.m_count; ++i)
+  {
+    double* const componentSamples = samples.data() + i * numTimes;
+    if(sampledPlug.m_curves[i].isNull())
+    {
+      std::fill(componentSamples, componentSamples + numTimes, sampledPlug.m_values[i]);
+      continue;
+    }
+
+    MFnAnimCurve fnCurve(sampledPlug.m_curves[i]);
+    for(size_t j = 0; j < numTimes; ++j)
+    {
+      fnCurve.evaluate(MTime(times[j], MTime::uiUnit()), componentSamples[j]);
+    }
+  }
+
+  const double scale = sampledPlug.m_scale;
+  const double* const x = samples.data();
+  const double* const y = x + numTimes;
+  const double* const z = y + numTimes;
+  UsdAttribute attr = sampledPlug.m_attr;
+  for(size_t j = 0; j < numTimes; ++j)
+  {
+    const UsdTimeCode timeCode(times[j]);
+    switch(sampledPlug.m_type)
+    {
+    case UsdDataType::kBool:
+      attr.Set(x[j] != 0.0, timeCode);
+      break;
+    case UsdDataType::kHalf:
+      attr.Set(GfHalf(float(x[j] * scale)), timeCode);
+      break;
+    case UsdDataType::kFloat:
+      attr.Set(float(x[j] * scale), timeCode);
+      break;
+    case UsdDataType::kDouble:
+      attr.Set(x[j] * scale, timeCode);
+      break;
+    case UsdDataType::kVec3h:
+      attr.Set(GfVec3h(x[j] * scale, y[j] * scale, z[j] * scale), timeCode);
+      break;
+    case UsdDataType::kVec3f:
+      attr.Set(GfVec3f(x[j] * scale, y[j] * scale, z[j] * scale), timeCode);
+      break;
+    case UsdDataType::kVec3d:
+      attr.Set(GfVec3d(x[j] * scale, y[j] * scale, z[j] * scale), timeCode);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  samples the visibility anim curve of a transform plug at all the export times
+//----------------------------------------------------------------------------------------------------------------------
+void sampleVisibilityCurve(const CurveSampledPlug& sampledPlug, const std::vector<double>& times)
+{
+  UsdAttribute attr = sampledPlug.m_attr;
+  MFnAnimCurve fnCurve(sampledPlug.m_curves[0]);
+  for(const double t : times)
+  {
+    double value = sampledPlug.m_values[0];
+    if(!sampledPlug.m_curves[0].isNull())
+    {
+      fnCurve.evaluate(MTime(t, MTime::uiUnit()), value);
+    }
+    attr.Set(value != 0.0 ? UsdGeomTokens->inherited : UsdGeomTokens->invisible, UsdTimeCode(t));
+  }
+}
+
+} // anon
+
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
@@ -55,12 +294,63 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
      (startWSM != endWSM) ||
      (!m_animatedNodes.empty()))
   {
+    std::vector<double> times;
     double increment = 1.0 / std::max(1U, params.m_subSamples);
     for(double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment)
+    {
+      times.push_back(t);
+    }
+
+    // Plugs driven directly by time based anim curves (the bulk of the plugs in layout and camera exports) are
+    // sampled from their curves for the whole frame range up front. Only the other plugs need the DG to be evaluated
+    // at each frame.
+    std::vector<PlugAttrVector::iterator> evaluatedAttribs;
+    std::vector<PlugAttrScaledVector::iterator> evaluatedAttribsScaled;
+    std::vector<PlugAttrVector::iterator> evaluatedTransformAttribs;
+    {
+      CurveSampledPlug sampledPlug;
+      for(auto it = startAttrib; it != endAttrib; ++it)
+      {
+        if(classifyPlug(it->first, it->second, 1.0, sampledPlug))
+          sampleAnimCurves(sampledPlug, times);
+        else
+          evaluatedAttribs.push_back(it);
+      }
+      for(auto it = startAttribScaled; it != endAttribScaled; ++it)
+      {
+        if(classifyPlug(it->first, it->second.attr, it->second.scale, sampledPlug))
+          sampleAnimCurves(sampledPlug, times);
+        else
+          evaluatedAttribsScaled.push_back(it);
+      }
+      for(auto it = startTransformAttrib; it != endTransformAttrib; ++it)
+      {
+        sampledPlug.m_attr = it->second;
+        sampledPlug.m_count = 1;
+        if(it->second.GetName() == UsdGeomTokens->visibility &&
+           getDirectAnimCurve(it->first, sampledPlug.m_curves[0], sampledPlug.m_values[0]))
+          sampleVisibilityCurve(sampledPlug, times);
+        else
+          evaluatedTransformAttribs.push_back(it);
+      }
+    }
+
+    if(evaluatedAttribs.empty() &&
+       evaluatedAttribsScaled.empty() &&
+       evaluatedTransformAttribs.empty() &&
+       (startMultiAttrib == endMultiAttrib) &&
+       (startMesh == endMesh) &&
+       (startWSM == endWSM) &&
+       m_animatedNodes.empty())
+    {
+      return;
+    }
+
+    for(const double t : times)
     {
       MAnimControl::setCurrentTime(t);
       UsdTimeCode timeCode(t);
-      for(auto it = startAttrib; it != endAttrib; ++it)
+      for(auto it : evaluatedAttribs)
       {
         /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
         ///         maya::Dg
@@ -68,7 +358,7 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
         ///         usdmaya::fileio::translator::Dg
         translators::DgNodeTranslator::copyAttributeValue(it->first, it->second, timeCode);
       }
-      for(auto it = startAttribScaled; it != endAttribScaled; ++it)
+      for(auto it : evaluatedAttribsScaled)
       {
         /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
         ///         maya::Dg
@@ -76,7 +366,7 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
         ///         usdmaya::fileio::translator::Dg
         translators::DgNodeTranslator::copyAttributeValue(it->first, it->second.attr, it->second.scale, timeCode);
       }
-      for (auto it = startTransformAttrib; it != endTransformAttrib; ++it)
+      for(auto it : evaluatedTransformAttribs)
       {
         translators::TransformTranslator::copyAttributeValue(it->first, it->second, timeCode);
       }
@@ -100,12 +100,18 @@ TranslatorManufacture::TranslatorManufacture(TranslatorContextPtr context)
 //----------------------------------------------------------------------------------------------------------------------
 
 TranslatorRefPtr TranslatorManufacture::get(const UsdPrim &prim)
+{
+  std::string assetType;
+  prim.GetMetadata(Metadata::assetType, &assetType);
+  return get(assetType, prim.GetTypeName());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+TranslatorRefPtr TranslatorManufacture::get(const std::string& assetType, const TfToken& typeName)
 {
   TranslatorRefPtr translator = TfNullPtr;
 
   //Try metadata first
-  std::string assetType;
-  prim.GetMetadata(Metadata::assetType, &assetType);
   if (!assetType.empty())
   {
     translator = getTranslatorByAssetTypeMetadata(assetType);
@@ -114,7 +120,7 @@ TranslatorRefPtr TranslatorManufacture::get(const UsdPrim &prim)
   //Then try schema - which tries C++ then python
   if (!translator)
   {
-    translator = getTranslatorBySchemaType(prim.GetTypeName() );
+    translator = getTranslatorBySchemaType(typeName);
   }
   return translator;
 }
@@ -337,6 +337,14 @@ public:
   AL_USDMAYA_PUBLIC
   TranslatorRefPtr get(const UsdPrim &prim);
 
+  /// \brief  returns a translator for a prim with the specified asset type metadata and schema type. This allows
+  ///         the prim data to be read ahead of time, e.g. in parallel for a large number of prims.
+  /// \param  assetType the value of the asset type metadata of the prim (may be empty)
+  /// \param  typeName the schema type name of the prim
+  /// \return the requested translator type
+  AL_USDMAYA_PUBLIC
+  TranslatorRefPtr get(const std::string& assetType, const TfToken& typeName);
+
   /// \brief  returns a translator for the specified  MObject (used for Import)
   /// \param  mayaObject the maya object for which you wish to check for a plugin node translator
   /// \return returns the requested translator type
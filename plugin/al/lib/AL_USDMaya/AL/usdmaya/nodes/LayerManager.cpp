@@ -19,6 +19,8 @@
 #include "AL/usdmaya/TypeIDs.h"
 #include "AL/usdmaya/nodes/LayerManager.h"
 
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/textFileFormat.h>
 #include <pxr/usd/usd/usdaFileFormat.h>
 #include <pxr/usd/usd/usdcFileFormat.h>
@@ -34,6 +36,7 @@
 #include <boost/thread.hpp>
 #include <boost/thread/shared_lock_guard.hpp>
 #include <mutex>
+#include <vector>
 
 namespace {
   // Global mutex protecting _findNode / findOrCreateNode.
@@ -291,6 +294,36 @@ MStatus LayerManager::initialise()
   return MS::kSuccess;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+void LayerManager::postConstructor()
+{
+  TfWeakPtr<LayerManager> me(this);
+  m_layersDidChangeNoticeKey = TfNotice::Register(me, &LayerManager::onLayersDidChange);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+LayerManager::~LayerManager()
+{
+  TfNotice::Revoke(m_layersDidChangeNoticeKey);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void LayerManager::onLayersDidChange(SdfNotice::LayersDidChange const& notice)
+{
+  std::lock_guard<std::mutex> lock(m_serializedLayersMutex);
+  if(m_serializedLayers.empty())
+    return;
+
+#if USD_VERSION_NUM > 1911
+  TF_FOR_ALL(itr, notice.GetChangeListVec())
+#else
+  TF_FOR_ALL(itr, notice.GetChangeListMap())
+#endif
+  {
+    m_serializedLayers.erase(itr->first);
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MObject LayerManager::findNode()
 {
@@ -386,6 +419,10 @@ bool LayerManager::removeLayer(SdfLayerHandle layer)
     return false;
   }
   boost::unique_lock<boost::shared_mutex> lock(m_layersMutex);
+  {
+    std::lock_guard<std::mutex> serializedLock(m_serializedLayersMutex);
+    m_serializedLayers.erase(layer);
+  }
   return m_layerDatabase.removeLayer(layerRef);
 }
 
@@ -425,9 +462,40 @@ MStatus LayerManager::populateSerialisationAttributes()
   AL_MAYA_CHECK_ERROR(status, errorString);
   {
     boost::shared_lock_guard<boost::shared_mutex> lock(m_layersMutex);
+
+    // Only serialize the layers which changed since the last save, the others reuse their previous serialization.
+    std::vector<SdfLayerHandle> changedLayers;
+    {
+      std::lock_guard<std::mutex> serializedLock(m_serializedLayersMutex);
+      for (const auto& layerAndIds : m_layerDatabase)
+      {
+        if (m_serializedLayers.find(layerAndIds.first) == m_serializedLayers.end())
+        {
+          changedLayers.push_back(layerAndIds.first);
+        }
+      }
+    }
+
+    TF_DEBUG(ALUSDMAYA_LAYERS).Msg("LayerManager::populateSerialisationAttributes serializing %zu changed layers\n",
+        changedLayers.size());
+
+    std::vector<std::string> changedSerializations(changedLayers.size());
+    WorkParallelForN(changedLayers.size(), [&changedLayers, &changedSerializations](size_t begin, size_t end)
+    {
+      for (size_t i = begin; i < end; ++i)
+      {
+        changedLayers[i]->ExportToString(&changedSerializations[i]);
+      }
+    });
+
+    std::lock_guard<std::mutex> serializedLock(m_serializedLayersMutex);
+    for (size_t i = 0; i < changedLayers.size(); ++i)
+    {
+      m_serializedLayers[changedLayers[i]] = std::move(changedSerializations[i]);
+    }
+
     MArrayDataBuilder builder(&dataBlock, layers(), m_layerDatabase.max_size(), &status);
     AL_MAYA_CHECK_ERROR(status, errorString);
-    std::string temp;
     for (const auto& layerAndIds : m_layerDatabase)
     {
       auto& layer = layerAndIds.first;
@@ -436,8 +504,7 @@ MStatus LayerManager::populateSerialisationAttributes()
       MDataHandle idHandle = layersElemHandle.child(m_identifier);
       idHandle.setString(AL::maya::utils::convert(layer->GetIdentifier()));
       MDataHandle serializedHandle = layersElemHandle.child(m_serialized);
-      layer->ExportToString(&temp);
-      serializedHandle.setString(AL::maya::utils::convert(temp));
+      serializedHandle.setString(AL::maya::utils::convert(m_serializedLayers[layer]));
       MDataHandle anonHandle = layersElemHandle.child(m_anonymous);
       anonHandle.setBool(layer->IsAnonymous());
     }
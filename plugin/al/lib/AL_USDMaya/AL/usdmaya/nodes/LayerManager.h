@@ -22,9 +22,12 @@
 
 #include <maya/MPxNode.h>
 
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/notice.h>
 #include <pxr/usd/usd/stage.h>
 
 #include <map>
+#include <mutex>
 #include <set>
 
 // On Windows, against certain versions of Maya and with strict compiler
@@ -241,7 +244,8 @@ private:
 //----------------------------------------------------------------------------------------------------------------------
 class LayerManager
   : public MPxNode,
-    public AL::maya::utils::NodeHelper
+    public AL::maya::utils::NodeHelper,
+    public TfWeakBase
 {
 public:
 
@@ -249,6 +253,10 @@ public:
   inline LayerManager()
     : MPxNode(), NodeHelper() {}
 
+  /// \brief  dtor
+  AL_USDMAYA_PUBLIC
+  ~LayerManager();
+
   /// \brief  Find the already-existing non-referenced LayerManager node in the scene, or return a null MObject
   /// \return the found LayerManager node, or a null MObject
   AL_USDMAYA_PUBLIC
@@ -314,6 +322,8 @@ public:
   void getLayerIdentifiers(MStringArray& outputNames);
 
   /// \brief  Ensures that the layers attribute will be filled out with serialized versions of all tracked layers.
+  ///         Layers which have not changed since they were last serialized reuse their previous serialization, the
+  ///         others are serialized in parallel.
   AL_USDMAYA_PUBLIC
   MStatus populateSerialisationAttributes();
 
@@ -358,8 +368,17 @@ public:
 private:
   static MObject _findNode();
 
+  void postConstructor() override;
+  void onLayersDidChange(SdfNotice::LayersDidChange const& notice);
+
   LayerDatabase m_layerDatabase;
 
+  // Serializations of the managed layers, kept between saves. Entries are dropped as soon as the layer changes,
+  // so that only the layers edited since the last save get serialized again.
+  std::map<SdfLayerHandle, std::string> m_serializedLayers;
+  std::mutex m_serializedLayersMutex;
+  TfNotice::Key m_layersDidChangeNoticeKey;
+
   // Note on layerManager / multithreading:
   // I don't know that layerManager will be used in a multihreaded manenr... but I also don't know it COULDN'T be.
   // (I haven't really looked into the way maya's new multi-threaded node evaluation works, for instance.) This is
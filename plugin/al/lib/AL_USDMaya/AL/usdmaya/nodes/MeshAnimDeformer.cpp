@@ -24,8 +24,6 @@
 #include <maya/MFnMesh.h>
 #include <maya/MTime.h>
 
-#include <pxr/usd/usdGeom/mesh.h>
-
 #include <mayaUsd/nodes/stageData.h>
 
 namespace AL {
@@ -42,6 +40,13 @@ MObject MeshAnimDeformer::m_inStageData = MObject::kNullObj;
 MObject MeshAnimDeformer::m_outMesh = MObject::kNullObj;
 MObject MeshAnimDeformer::m_inMesh = MObject::kNullObj;
 
+//----------------------------------------------------------------------------------------------------------------------
+MeshAnimDeformer::~MeshAnimDeformer()
+{
+  MNodeMessage::removeCallback(m_attributeChanged);
+  unregisterMesh();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 MStatus MeshAnimDeformer::initialise()
 {
@@ -89,35 +94,38 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
   MObject obj = inputHandle.asMesh();
 
   UsdStageRefPtr stage = getStage();
-  if(stage)
+  proxy::MeshAnimCache* cache = getMeshAnimCache();
+  if(stage && cache)
   {
-    UsdPrim prim = stage->GetPrimAtPath(m_cachePath);
-    UsdGeomMesh mesh(prim);
+    if(m_registeredPath != m_cachePath)
+    {
+      unregisterMesh();
+      cache->registerMesh(m_cachePath);
+      m_registeredPath = m_cachePath;
+    }
 
-    MFnMesh fnMesh(obj);
-    float* const ptr = (float*)fnMesh.getRawPoints(&status);
-    if(ptr)
+    // The values of all the meshes read from the proxy shape are resolved in a single pass, the first time one of
+    // them is requested at this time. Values which are not time varying are left empty.
+    VtArray<GfVec3f> pointData, normalData;
+    if(cache->fetch(stage, m_cachePath, usdTime, pointData, normalData))
     {
-      UsdAttribute points = mesh.GetPointsAttr();
-      if(points.GetNumTimeSamples() > 1)
+      MFnMesh fnMesh(obj);
+      if(!pointData.empty() && pointData.size() == size_t(fnMesh.numVertices()))
       {
-        VtArray<GfVec3f> pointData;
-        points.Get(&pointData, usdTime);
-        const size_t numPoints = pointData.size();
-        std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
+        float* const ptr = (float*)fnMesh.getRawPoints(&status);
+        if(ptr)
+        {
+          std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * pointData.size());
+        }
       }
-    }
 
-    float* const nptr = (float*)fnMesh.getRawNormals(&status);
-    if(nptr)
-    {
-      UsdAttribute normals = mesh.GetNormalsAttr();
-      if(normals.GetNumTimeSamples() > 1)
+      if(!normalData.empty() && normalData.size() == size_t(fnMesh.numNormals()))
       {
-        VtArray<GfVec3f> normalData;
-        normals.Get(&normalData, usdTime);
-        const size_t numNormals = normalData.size();
-        std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
+        float* const nptr = (float*)fnMesh.getRawNormals(&status);
+        if(nptr)
+        {
+          std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * normalData.size());
+        }
       }
     }
     outputHandle.set(obj);
@@ -149,6 +157,7 @@ MStatus MeshAnimDeformer::connectionBroken(const MPlug& plug, const MPlug& other
     MFnDependencyNode otherNode(otherPlug.node());
     if (otherNode.typeId() == ProxyShape::kTypeId)
     {
+      unregisterMesh();
       proxyShapeHandle = MObject();
     }
   }
@@ -171,6 +180,34 @@ UsdStageRefPtr MeshAnimDeformer::getStage()
   return UsdStageRefPtr();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+proxy::MeshAnimCache* MeshAnimDeformer::getMeshAnimCache()
+{
+  if(proxyShapeHandle.isValid() && proxyShapeHandle.isAlive())
+  {
+    MFnDependencyNode fn(proxyShapeHandle.object());
+    ProxyShape* node = (ProxyShape*)fn.userNode();
+    if(node)
+    {
+      return &node->meshAnimCache();
+    }
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimDeformer::unregisterMesh()
+{
+  if(!m_registeredPath.IsEmpty())
+  {
+    if(proxy::MeshAnimCache* cache = getMeshAnimCache())
+    {
+      cache->unregisterMesh(m_registeredPath);
+    }
+    m_registeredPath = SdfPath();
+  }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void MeshAnimDeformer::postConstructor()
 {
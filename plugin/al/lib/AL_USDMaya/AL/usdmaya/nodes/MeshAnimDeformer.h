@@ -23,6 +23,16 @@
 #include <maya/MNodeMessage.h>
 #include <maya/MObjectHandle.h>
 
+namespace AL {
+namespace usdmaya {
+namespace nodes {
+namespace proxy {
+struct MeshAnimCache;
+}
+}
+}
+}
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -44,8 +54,7 @@ public:
     : MPxNode(), NodeHelper()
      {}
 
-  inline ~MeshAnimDeformer()
-    { MNodeMessage::removeCallback(m_attributeChanged); }
+  ~MeshAnimDeformer();
 
   //--------------------------------------------------------------------------------------------------------------------
   /// Type Info & Registration
@@ -69,8 +78,11 @@ private:
   static void onAttributeChanged(MNodeMessage::AttributeMessage, MPlug&, MPlug&, void*);
   MStatus compute(const MPlug& plug, MDataBlock& data) override;
   UsdStageRefPtr getStage();
+  proxy::MeshAnimCache* getMeshAnimCache();
+  void unregisterMesh();
 private:
   SdfPath m_cachePath;
+  SdfPath m_registeredPath;
   MObjectHandle proxyShapeHandle;
   MCallbackId m_attributeChanged = 0;
 };
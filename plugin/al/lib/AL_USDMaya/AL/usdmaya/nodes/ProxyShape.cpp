@@ -53,6 +53,7 @@
 
 #include "AL/usd/transaction/TransactionManager.h"
 
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/ar/resolver.h>
 
 #include <pxr/usd/usdGeom/imageable.h>
@@ -64,6 +65,7 @@
 
 #include <mayaUsd/listeners/proxyShapeNotice.h>
 #include <mayaUsd/nodes/stageData.h>
+#include <mayaUsd/utils/stageWarmUp.h>
 #include <mayaUsd/utils/utilFileSystem.h>
 
 #include <boost/filesystem.hpp>
@@ -685,10 +687,26 @@ void ProxyShape::trackAllDirtyLayers(LayerManager* layerManager)
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::onPrimResync(SdfPath primPath, SdfPathVector& previousPrims)
 {
-  TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("ProxyShape::onPrimResync checking %s\n", primPath.GetText());
+  onPrimResync(SdfPathVector{primPath}, previousPrims);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void ProxyShape::onPrimResync(const SdfPathVector& primPaths, SdfPathVector& previousPrims)
+{
+  SdfPathVector resyncPaths;
+  resyncPaths.reserve(primPaths.size());
+  for(const SdfPath& primPath : primPaths)
+  {
+    TF_DEBUG(ALUSDMAYA_TRANSLATORS).Msg("ProxyShape::onPrimResync checking %s\n", primPath.GetText());
+
+    UsdPrim resyncPrim = m_stage->GetPrimAtPath(primPath);
+    if(resyncPrim.IsValid())
+    {
+      resyncPaths.push_back(primPath);
+    }
+  }
 
-  UsdPrim resyncPrim = m_stage->GetPrimAtPath(primPath);
-  if(!resyncPrim.IsValid())
+  if(resyncPaths.empty())
   {
     return;
   }
@@ -701,8 +719,14 @@ void ProxyShape::onPrimResync(SdfPath primPath, SdfPathVector& previousPrims)
   fn.getPath(proxyTransformPath);
   proxyTransformPath.pop();
 
-  // find the new set of prims
-  UsdPrimVector newPrimSet = huntForNativeNodesUnderPrim(proxyTransformPath, primPath, translatorManufacture());
+  // find the new set of prims under each of the changed prims. The prim filter diffs them against the previously
+  // translated prims, so that only the translators of added, removed and dirty prims are touched.
+  UsdPrimVector newPrimSet;
+  for(const SdfPath& primPath : resyncPaths)
+  {
+    UsdPrimVector primSet = huntForNativeNodesUnderPrim(proxyTransformPath, primPath, translatorManufacture());
+    newPrimSet.insert(newPrimSet.end(), primSet.begin(), primSet.end());
+  }
 
   // Remove prims that have disappeared and translate in new prims
   translatePrimsIntoMaya(newPrimSet, previousPrims);
@@ -849,6 +873,9 @@ void ProxyShape::onObjectsChanged(UsdNotice::ObjectsChanged const& notice, UsdSt
 
   TF_DEBUG(ALUSDMAYA_EVENTS).Msg("ProxyShape::onObjectsChanged called m_compositionHasChanged=%i\n", m_compositionHasChanged);
 
+  // Values read by the mesh deformers may have been edited
+  m_meshAnimCache.invalidate(!notice.GetResyncedPaths().empty());
+
   if (!AL::usd::transaction::TransactionManager::InProgress(sender))
   {
     TF_DEBUG(ALUSDMAYA_EVENTS).Msg("ProxyShape::onObjectsChanged - no transaction in progress - processing all changes\n");
@@ -1018,13 +1045,21 @@ void ProxyShape::processChangedObjects(const SdfPathVector& resyncedPaths, const
   if(m_compositionHasChanged)
   {
     m_compositionHasChanged = false;
-    onPrimResync(m_changedPath, m_variantSwitchedPrims);
+    onPrimResync(m_changedPaths, m_variantSwitchedPrims);
     m_variantSwitchedPrims.clear();
-    m_changedPath = SdfPath();
+    m_changedPaths.clear();
 
-    std::stringstream strstr;
-    strstr << "Breakdown for Variant Switch:\n";
-    AL::usdmaya::Profiler::printReport(strstr);
+    if(TfDebug::IsEnabled(ALUSDMAYA_EVENTS))
+    {
+      std::stringstream strstr;
+      strstr << "Breakdown for Variant Switch:\n";
+      AL::usdmaya::Profiler::printReport(strstr);
+      TfDebug::Helper().Msg("%s", strstr.str().c_str());
+    }
+    else
+    {
+      AL::usdmaya::Profiler::clearAll();
+    }
   }
 }
 
@@ -1037,7 +1072,6 @@ std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
 {
   TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::huntForNativeNodesUnderPrim\n");
   std::vector<UsdPrim> prims;
-  fileio::SchemaPrimsUtils utils(manufacture);
 
   const UsdPrim prim = m_stage->GetPrimAtPath(startPath);
   if (!prim.IsValid())
@@ -1050,19 +1084,44 @@ std::vector<UsdPrim> ProxyShape::huntForNativeNodesUnderPrim(
     return prims;
   }
 
+  std::vector<UsdPrim> candidates;
   fileio::TransformIterator it(prim, proxyTransformPath);
   for(; !it.done(); it.next())
   {
     UsdPrim prim = it.prim();
-    if(!prim.IsValid())
+    if(prim.IsValid())
     {
-      continue;
+      candidates.push_back(prim);
     }
+  }
 
-    fileio::translators::TranslatorRefPtr trans = utils.isSchemaPrim(prim);
+  // Reading the metadata which selects the translator of each prim is the bulk of the work, do it in parallel. The
+  // translators themselves are then looked up on this thread (they may be python translators), once per distinct
+  // asset type and schema type.
+  std::vector<std::string> assetTypes(candidates.size());
+  WorkParallelForN(candidates.size(), [&candidates, &assetTypes](size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; ++i)
+    {
+      candidates[i].GetMetadata(Metadata::assetType, &assetTypes[i]);
+    }
+  });
+
+  std::map<std::pair<std::string, TfToken>, fileio::translators::TranslatorRefPtr> translators;
+  for(size_t i = 0, n = candidates.size(); i < n; ++i)
+  {
+    const UsdPrim& candidate = candidates[i];
+    auto key = std::make_pair(std::move(assetTypes[i]), candidate.GetTypeName());
+    auto found = translators.find(key);
+    if(found == translators.end())
+    {
+      found = translators.emplace(key, manufacture.get(key.first, key.second)).first;
+    }
+
+    const fileio::translators::TranslatorRefPtr& trans = found->second;
     if(trans && (trans->importableByDefault() || importAll))
     {
-      prims.push_back(prim);
+      prims.push_back(candidate);
     }
   }
   return prims;
@@ -1104,6 +1163,9 @@ void ProxyShape::variantSelectionListener(SdfNotice::LayersDidChange const& noti
       const SdfPath &path = entryIter->first;
       const SdfChangeList::Entry &entry = entryIter->second;
 
+      if (entry.infoChanged.empty())
+        continue;
+
       TF_FOR_ALL(it, entry.infoChanged)
       {
         if (it->first == SdfFieldKeys->VariantSelection ||
@@ -1116,21 +1178,47 @@ void ProxyShape::variantSelectionListener(SdfNotice::LayersDidChange const& noti
                                          entry.oldIdentifier.c_str(),
                                          path.GetText(),
                                          itr->first->GetIdentifier().c_str());
-          if(!m_compositionHasChanged)
+          m_compositionHasChanged = true;
+
+          // Only the prims below the changed prim need to be torn down, which has already been done if one of its
+          // ancestors was changed as well.
+          if(addChangedPath(path))
           {
-            TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::Not yet in a composition change state. Recording path. \n");
-            m_changedPath = path;
+            onPrePrimChanged(path, m_variantSwitchedPrims);
           }
-          m_compositionHasChanged = true;
-          onPrePrimChanged(path, m_variantSwitchedPrims);
 
           triggerEvent("PostVariantChangedCB");
+
+          // a single change of the prim is enough to re-translate it
+          break;
         }
       }
     }
   }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+bool ProxyShape::addChangedPath(const SdfPath& path)
+{
+  for(const SdfPath& changedPath : m_changedPaths)
+  {
+    if(path.HasPrefix(changedPath))
+    {
+      TF_DEBUG(ALUSDMAYA_EVALUATION).Msg("ProxyShape::addChangedPath %s is already covered by %s\n",
+                                         path.GetText(), changedPath.GetText());
+      return false;
+    }
+  }
+
+  // the descendants of the new path are re-translated along with it
+  m_changedPaths.erase(
+      std::remove_if(m_changedPaths.begin(), m_changedPaths.end(),
+                     [&path](const SdfPath& changedPath) { return changedPath.HasPrefix(path); }),
+      m_changedPaths.end());
+  m_changedPaths.push_back(path);
+  return true;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::loadStage()
 {
@@ -1366,6 +1454,13 @@ void ProxyShape::loadStage()
         }
         AL_END_PROFILE_SECTION();
 
+        if(m_stage && UsdMayaStageWarmUp::IsEnabled())
+        {
+          AL_BEGIN_PROFILE_SECTION(WarmUpUsdStage);
+          UsdMayaStageWarmUp(m_stage).Run();
+          AL_END_PROFILE_SECTION();
+        }
+
         AL_BEGIN_PROFILE_SECTION(ResetGlobalVariantFallbacks);
         // reset only if the global variant fallbacks has been modified
         if (!fallbacks.empty())
@@ -1425,6 +1520,9 @@ void ProxyShape::loadStage()
     MGlobal::displayInfo(AL::maya::utils::convert(strstr.str()));
   }
 
+  // The bounding boxes saved with the scene don't apply to the new stage.
+  _ReleasePersistedBoundingBoxes();
+
   destroyGLImagingEngine();
   stageDataDirtyPlug().setValue(true);
 
@@ -1687,6 +1785,40 @@ bool ProxyShape::isBounded() const
   return true;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+SdfLayerRefPtr ProxyShape::GetInitialSessionLayer(MDataBlock& dataBlock)
+{
+  // Same lookup as loadStage(), without reporting missing layers.
+  const MString sessionLayerName = inputStringValue(dataBlock, m_sessionLayerName);
+  if (sessionLayerName.length() > 0)
+  {
+    auto layerManager = LayerManager::findManager();
+    if (layerManager)
+    {
+      SdfLayerRefPtr sessionLayer = layerManager->findLayer(AL::maya::utils::convert(sessionLayerName));
+      if (sessionLayer)
+      {
+        return sessionLayer;
+      }
+    }
+  }
+
+  const MString serializedSessionLayer = inputStringValue(dataBlock, m_serializedSessionLayer);
+  if (serializedSessionLayer.length() != 0)
+  {
+    SdfLayerRefPtr sessionLayer = SdfLayer::CreateAnonymous();
+    sessionLayer->ImportFromString(AL::maya::utils::convert(serializedSessionLayer));
+    return sessionLayer;
+  }
+  return SdfLayerRefPtr();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool ProxyShape::GetInitialLoadPayloads(MDataBlock dataBlock) const
+{
+  return !inputBoolValue(dataBlock, m_unloaded);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::CacheEmptyBoundingBox(MBoundingBox& cachedBBox)
 {
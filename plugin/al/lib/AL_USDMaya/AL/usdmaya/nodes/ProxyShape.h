@@ -26,6 +26,7 @@
 #include "AL/usdmaya/fileio/translators/TranslatorBase.h"
 #include "AL/usdmaya/fileio/translators/TranslatorContext.h"
 #include "AL/usdmaya/nodes/proxy/LockManager.h"
+#include "AL/usdmaya/nodes/proxy/MeshAnimCache.h"
 #include "AL/usdmaya/nodes/proxy/PrimFilter.h"
 #include "AL/usdmaya/SelectabilityDB.h"
 
@@ -710,6 +711,14 @@ public:
   AL_USDMAYA_PUBLIC
   void onPrimResync(SdfPath primPath, SdfPathVector& changedPaths);
 
+  /// \brief Re-Creates and updates the maya prim hierarchies starting from each of the specified primpaths, in a
+  ///        single pass so that the translated prims are only diffed once.
+  /// \param[in] primPaths of the points in the hierarchy that are potentially undergoing structural changes. None of
+  ///        them may be a descendant of another.
+  /// \param[in] changedPaths are child paths that existed previously and may not be existing now.
+  AL_USDMAYA_PUBLIC
+  void onPrimResync(const SdfPathVector& primPaths, SdfPathVector& changedPaths);
+
   /// \brief Preps translators for change, and then re-ceates and updates the maya prim hierarchy below the
   ///        specified primPath as if a variant change occurred.
   /// \param[in] primPath of the point in the hierarchy that is potentially undergoing structural changes
@@ -742,8 +751,10 @@ public:
       return;
     }
     m_compositionHasChanged = true;
-    m_changedPath = changePath;
-    onPrePrimChanged(m_changedPath, m_variantSwitchedPrims);
+    if(addChangedPath(changePath))
+    {
+      onPrePrimChanged(changePath, m_variantSwitchedPrims);
+    }
   }
 
   /// \brief  change the status of the composition changed status
@@ -771,6 +782,11 @@ public:
   const AL::usdmaya::SelectabilityDB& selectabilityDB() const
     { return const_cast<ProxyShape*>(this)->selectabilityDB(); }
 
+  /// \brief Returns the cache of animated mesh values read by the MeshAnimDeformer nodes connected to this ProxyShape
+  /// \return The MeshAnimCache owned by the ProxyShape
+  proxy::MeshAnimCache& meshAnimCache()
+    { return m_meshAnimCache; }
+
   /// \brief  used to reload the stage after file open
   AL_USDMAYA_PUBLIC
   void loadStage();
@@ -960,6 +976,8 @@ private:
   MStatus preEvaluation(const MDGContext & context, const MEvaluationNode& evaluationNode) override;
   void CacheEmptyBoundingBox(MBoundingBox&) override;
   UsdTimeCode GetOutputTime(MDataBlock) const override;
+  SdfLayerRefPtr GetInitialSessionLayer(MDataBlock&) override;
+  bool GetInitialLoadPayloads(MDataBlock) const override;
   void copyInternalData(MPxNode* srcNode) override;
 
   //--------------------------------------------------------------------------------------------------------------------
@@ -1011,6 +1029,7 @@ private:
   void layerIdChanged(SdfNotice::LayerIdentifierDidChange const& notice, UsdStageWeakPtr const& sender);
   void onObjectsChanged(UsdNotice::ObjectsChanged const&, UsdStageWeakPtr const& sender);
   void variantSelectionListener(SdfNotice::LayersDidChange const& notice);
+  bool addChangedPath(const SdfPath& path);
   void onEditTargetChanged(UsdNotice::StageEditTargetChanged const& notice, UsdStageWeakPtr const& sender);
   void trackEditTargetLayer(LayerManager* layerManager=nullptr);
   void trackAllDirtyLayers(LayerManager* layerManager=nullptr);
@@ -1087,6 +1106,7 @@ private:
   SdfPathVector m_excludedGeometry;
   SdfPathVector m_excludedTaggedGeometry;
   proxy::LockManager m_lockManager;
+  proxy::MeshAnimCache m_meshAnimCache;
   static MObject m_transformTranslate;
   static MObject m_transformRotate;
   static MObject m_transformScale;
@@ -1096,7 +1116,7 @@ private:
   SdfPath m_path;
   fileio::translators::TranslatorContextPtr m_context;
   fileio::translators::TranslatorManufacture m_translatorManufacture;
-  SdfPath m_changedPath;
+  SdfPathVector m_changedPaths;
   SdfPathVector m_variantSwitchedPrims;
   SdfLayerHandle m_prevEditTarget;
   Engine* m_engine = 0;
@@ -0,0 +1,201 @@
+//
+// Copyright 2020 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usdmaya/nodes/proxy/MeshAnimCache.h"
+#include "AL/usdmaya/DebugCodes.h"
+
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usdGeom/mesh.h>
+
+namespace AL {
+namespace usdmaya {
+namespace nodes {
+namespace proxy {
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::registerMesh(const SdfPath& path)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  Entry& entry = m_entries[path];
+  if(entry.refCount++ == 0)
+  {
+    // deformers register one after the other, only build the queries of the new mesh on the next fetch.
+    m_pendingPaths.push_back(path);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::unregisterMesh(const SdfPath& path)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(path);
+  if(it != m_entries.end() && --it->second.refCount == 0)
+  {
+    m_entries.erase(it);
+    m_queriesDirty = true;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+bool MeshAnimCache::fetch(const UsdStageRefPtr& stage, const SdfPath& path, UsdTimeCode time,
+                          VtArray<GfVec3f>& points, VtArray<GfVec3f>& normals)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto it = m_entries.find(path);
+  if(it == m_entries.end())
+  {
+    return false;
+  }
+
+  if(m_queriesDirty || m_stage != stage)
+  {
+    rebuildQueries(stage);
+  }
+  else if(!m_pendingPaths.empty())
+  {
+    // meshes registered since the last pass are resolved on their own if the time hasn't changed.
+    for(const SdfPath& pendingPath : m_pendingPaths)
+    {
+      auto pending = m_entries.find(pendingPath);
+      if(pending != m_entries.end())
+      {
+        buildQueries(stage, pendingPath, pending->second);
+        if(m_resolved)
+        {
+          resolve(pending->second, m_time);
+        }
+      }
+    }
+    m_pendingPaths.clear();
+  }
+
+  if(!m_resolved || m_time != time)
+  {
+    resolve(time);
+  }
+
+  const Entry& entry = it->second;
+  if(!entry.valid)
+  {
+    return false;
+  }
+
+  // the arrays share their buffers with the cache. VtArray is copy on write, so resolving the next time never modifies
+  // the buffers handed out here, and the caller can keep reading them after the lock is released.
+  points = entry.pointData;
+  normals = entry.normalData;
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::invalidate(bool resynced)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_resolved = false;
+  if(resynced)
+  {
+    m_queriesDirty = true;
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::buildQueries(const UsdStageRefPtr& stage, const SdfPath& path, Entry& entry)
+{
+  entry.points = UsdAttributeQuery();
+  entry.normals = UsdAttributeQuery();
+  entry.pointData = VtArray<GfVec3f>();
+  entry.normalData = VtArray<GfVec3f>();
+  entry.valid = false;
+
+  UsdGeomMesh mesh(stage ? stage->GetPrimAtPath(path) : UsdPrim());
+  if(!mesh)
+  {
+    return;
+  }
+  entry.valid = true;
+
+  // only keep the queries of time varying attributes, the others are never resolved.
+  UsdAttributeQuery points(mesh.GetPointsAttr());
+  if(points.ValueMightBeTimeVarying())
+  {
+    entry.points = std::move(points);
+  }
+  UsdAttributeQuery normals(mesh.GetNormalsAttr());
+  if(normals.ValueMightBeTimeVarying())
+  {
+    entry.normals = std::move(normals);
+  }
+
+  if(entry.points.IsValid() || entry.normals.IsValid())
+  {
+    m_animatedEntries.push_back(&entry);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::rebuildQueries(const UsdStageRefPtr& stage)
+{
+  TF_DEBUG(ALUSDMAYA_GEOMETRY_DEFORMER).Msg("MeshAnimCache::rebuildQueries %zu meshes\n", m_entries.size());
+
+  m_animatedEntries.clear();
+  for(auto& it : m_entries)
+  {
+    buildQueries(stage, it.first, it.second);
+  }
+
+  m_pendingPaths.clear();
+  m_stage = stage;
+  m_queriesDirty = false;
+  m_resolved = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::resolve(UsdTimeCode time)
+{
+  TF_DEBUG(ALUSDMAYA_GEOMETRY_DEFORMER).Msg("MeshAnimCache::resolve %zu meshes at %f\n",
+      m_animatedEntries.size(), time.GetValue());
+
+  WorkParallelForN(m_animatedEntries.size(), [this, time](size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; ++i)
+    {
+      resolve(*m_animatedEntries[i], time);
+    }
+  });
+
+  m_time = time;
+  m_resolved = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+void MeshAnimCache::resolve(Entry& entry, UsdTimeCode time)
+{
+  if(entry.points.IsValid())
+  {
+    entry.points.Get(&entry.pointData, time);
+  }
+  if(entry.normals.IsValid())
+  {
+    entry.normals.Get(&entry.normalData, time);
+  }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+} // proxy
+} // nodes
+} // usdmaya
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
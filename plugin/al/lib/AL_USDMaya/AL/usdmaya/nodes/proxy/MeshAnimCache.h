@@ -0,0 +1,111 @@
+//
+// Copyright 2020 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#pragma once
+
+#include <AL/usdmaya/Api.h>
+
+#include <pxr/base/gf/vec3f.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace AL {
+namespace usdmaya {
+namespace nodes {
+namespace proxy {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Reads the animated points and normals of the meshes driven by MeshAnimDeformer nodes connected to a proxy
+///         shape. The first deformer evaluated at a new time resolves the values of all the registered meshes in
+///         a single parallel pass, using cached attribute queries. The other deformers evaluated at the same time
+///         then simply pick up the values resolved for their mesh.
+///
+///         Values are resolved with the interpolation of the stage, i.e. sub-frame times are linearly interpolated
+///         by default. Attributes which are not time varying are never resolved, the deformer leaves the input
+///         mesh values untouched for them.
+//----------------------------------------------------------------------------------------------------------------------
+struct MeshAnimCache
+{
+  /// \brief  registers the mesh at the specified path, so that its values get resolved along with the other meshes.
+  ///         Meshes are reference counted, as more than one deformer may read the same mesh.
+  /// \param  path the path of the UsdGeomMesh prim
+  AL_USDMAYA_PUBLIC
+  void registerMesh(const SdfPath& path);
+
+  /// \brief  unregisters the mesh at the specified path.
+  /// \param  path the path of the UsdGeomMesh prim
+  AL_USDMAYA_PUBLIC
+  void unregisterMesh(const SdfPath& path);
+
+  /// \brief  retrieves the points and normals of a registered mesh at the specified time, resolving the values of
+  ///         all the registered meshes if needed. The returned arrays share their data with the cache, they are
+  ///         not copied. Call is thread safe.
+  /// \param  stage the stage of the proxy shape
+  /// \param  path the path of the UsdGeomMesh prim
+  /// \param  time the time at which to retrieve the values
+  /// \param  points returned points, left empty if they are not time varying
+  /// \param  normals returned normals, left empty if they are not time varying
+  /// \return false if the mesh is not registered or isn't a valid mesh
+  AL_USDMAYA_PUBLIC
+  bool fetch(const UsdStageRefPtr& stage, const SdfPath& path, UsdTimeCode time,
+             VtArray<GfVec3f>& points, VtArray<GfVec3f>& normals);
+
+  /// \brief  drops the resolved values following a change to the stage, so that they are resolved again on the
+  ///         next fetch.
+  /// \param  resynced true if prims were resynced, in which case the attribute queries are rebuilt as well
+  AL_USDMAYA_PUBLIC
+  void invalidate(bool resynced);
+
+private:
+  struct Entry
+  {
+    UsdAttributeQuery points;
+    UsdAttributeQuery normals;
+    VtArray<GfVec3f> pointData;
+    VtArray<GfVec3f> normalData;
+    uint32_t refCount = 0;
+    bool valid = false;
+  };
+
+  void buildQueries(const UsdStageRefPtr& stage, const SdfPath& path, Entry& entry);
+  void rebuildQueries(const UsdStageRefPtr& stage);
+  void resolve(UsdTimeCode time);
+  static void resolve(Entry& entry, UsdTimeCode time);
+
+  std::mutex m_mutex;
+  std::unordered_map<SdfPath, Entry, SdfPath::Hash> m_entries;
+  std::vector<Entry*> m_animatedEntries;
+  SdfPathVector m_pendingPaths;
+  UsdStageWeakPtr m_stage;
+  UsdTimeCode m_time = UsdTimeCode::Default();
+  bool m_queriesDirty = true;
+  bool m_resolved = false;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+} // proxy
+} // nodes
+} // usdmaya
+} // AL
+//----------------------------------------------------------------------------------------------------------------------
@@ -16,9 +16,12 @@
 
 #include "AL/maya/utils/Utils.h"
 #include "test_usdmaya.h"
+#include <maya/MAnimControl.h>
 #include <maya/MGlobal.h>
 #include <maya/MFileIO.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MMatrix.h>
+#include <maya/MSelectionList.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/xform.h>
@@ -173,3 +176,54 @@ TEST(ExportCommands, extensiveAnimationCheck)
   MGlobal::executeCommand(exportCmd, true);
   expectAnimation(false);
 }
+
+TEST(ExportCommands, animCurveSampledPlugs)
+{
+  MFileIO::newFile(true);
+  // the translation and visibility are driven by anim curves, which are sampled directly, while the rotation is
+  // driven by an expression, which is evaluated through the DG at each frame.
+  MGlobal::executeCommand(MString(
+      "polyCube -n cube;"
+      "setKeyframe -t 1 -v 0 cube.tx;setKeyframe -t 10 -v 9 cube.tx;"
+      "setKeyframe -t 1 -v 2 cube.ty;setKeyframe -t 10 -v 4 cube.ty;"
+      "setKeyframe -t 1 -v 1 cube.v;setKeyframe -t 5 -v 0 cube.v;"
+      "expression -s \"cube.rotateY = frame * 10\";"
+      "select cube;"), false, true);
+
+  const std::string temp_path = buildTempPath("AL_USDMayaTests_animCurveSampledPlugs.usda");
+  MString exportCmd;
+  exportCmd.format(MString("AL_usdmaya_ExportCommand -f \"^1s\" -sl 1 -frameRange 1 10"), AL::maya::utils::convert(temp_path));
+  MGlobal::executeCommand(exportCmd, true);
+
+  UsdStageRefPtr stage = UsdStage::Open(temp_path);
+  ASSERT_TRUE(stage);
+  UsdGeomXform transform(stage->GetPrimAtPath(SdfPath("/cube")));
+  ASSERT_TRUE(transform);
+
+  MSelectionList sl;
+  sl.add("cube");
+  MDagPath cubePath;
+  sl.getDagPath(0, cubePath);
+
+  for(int frame = 1; frame <= 10; ++frame)
+  {
+    MAnimControl::setCurrentTime(MTime(frame, MTime::uiUnit()));
+    const UsdTimeCode timeCode(frame);
+
+    GfMatrix4d usdMatrix;
+    bool resetsXformStack;
+    EXPECT_TRUE(transform.GetLocalTransformation(&usdMatrix, &resetsXformStack, timeCode));
+    const MMatrix mayaMatrix = cubePath.inclusiveMatrix();
+    for(int i = 0; i < 4; ++i)
+    {
+      for(int j = 0; j < 4; ++j)
+      {
+        EXPECT_NEAR(mayaMatrix[i][j], usdMatrix[i][j], 1e-5);
+      }
+    }
+
+    TfToken visibility;
+    EXPECT_TRUE(transform.GetVisibilityAttr().Get(&visibility, timeCode));
+    EXPECT_EQ(MFnDagNode(cubePath).findPlug("visibility", true).asBool() ? UsdGeomTokens->inherited : UsdGeomTokens->invisible, visibility);
+  }
+}
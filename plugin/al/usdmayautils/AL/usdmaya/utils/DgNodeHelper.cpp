@@ -20,6 +20,7 @@
 #include <mayaUsdUtils/SIMD.h>
 
 #include <maya/MDGModifier.h>
+#include <maya/MDoubleArray.h>
 #include <maya/MFloatArray.h>
 #include <maya/MFloatMatrix.h>
 #include <maya/MFnCompoundAttribute.h>
@@ -33,6 +34,7 @@
 #include <maya/MMatrix.h>
 #include <maya/MMatrixArray.h>
 #include <maya/MObjectArray.h>
+#include <maya/MTimeArray.h>
 
 #include <iostream>
 
@@ -1042,34 +1044,145 @@ MStatus DgNodeHelper::prepareAnimCurve(const MPlug &plug, MFnAnimCurve &animCurv
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-MStatus DgNodeHelper::setAngleAnim(MObject node, MObject attr, const UsdGeomXformOp op, MObjectArray *newAnimCurves)
+namespace {
+/// converts the key frame values to doubles, applying the scaling factor
+void convertKeyValues(double* const dst, const float* const src, const size_t count, const double conversionFactor)
 {
-  MStatus status;
-  const char* const errorString = "DgNodeHelper::setAngleAnim";
+  size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+# ifdef __AVX__
+  const d256 conversionFactor256 = splat4d(conversionFactor);
+  for(const size_t count4 = count & ~3ULL; i < count4; i += 4)
+  {
+    storeu4d(dst + i, mul4d(conversionFactor256, cvt4f_to_4d(loadu4f(src + i))));
+  }
+# else
+  const d128 conversionFactor128 = splat2d(conversionFactor);
+  for(const size_t count2 = count & ~1ULL; i < count2; i += 2)
+  {
+    storeu2d(dst + i, mul2d(conversionFactor128, cvt2f_to_2d(load2f(src + i))));
+  }
+# endif
+#endif
+  for(; i < count; ++i)
+  {
+    dst[i] = src[i] * conversionFactor;
+  }
+}
 
-  MPlug plug(node, attr);
-  MFnAnimCurve fnCurve;
-  status = prepareAnimCurve(plug, fnCurve, newAnimCurves);
-  if(!status)return MS::kFailure;
+/// applies the scaling factor to the key frame values
+void convertKeyValues(double* const dst, const double* const src, const size_t count, const double conversionFactor)
+{
+  size_t i = 0;
+#if AL_UTILS_ENABLE_SIMD
+# ifdef __AVX__
+  const d256 conversionFactor256 = splat4d(conversionFactor);
+  for(const size_t count4 = count & ~3ULL; i < count4; i += 4)
+  {
+    storeu4d(dst + i, mul4d(conversionFactor256, loadu4d(src + i)));
+  }
+# else
+  const d128 conversionFactor128 = splat2d(conversionFactor);
+  for(const size_t count2 = count & ~1ULL; i < count2; i += 2)
+  {
+    storeu2d(dst + i, mul2d(conversionFactor128, loadu2d(src + i)));
+  }
+# endif
+#endif
+  for(; i < count; ++i)
+  {
+    dst[i] = src[i] * conversionFactor;
+  }
+}
+
+template<typename T>
+MStatus setAnimCurvesImpl(const MPlugArray& plugs, const std::vector<double>& times, const std::vector<T>& values,
+                          const double conversionFactor, MObjectArray* const newAnimCurves)
+{
+  const char* const errorString = "DgNodeHelper::setAnimCurves: Error adding keyframes";
+  const uint32_t numPlugs = plugs.length();
+  const uint32_t numKeys = uint32_t(times.size());
+  if(values.size() != size_t(numPlugs) * numKeys)
+  {
+    return MS::kFailure;
+  }
+
+  // create or clear all the curves first, so that no key is added if one of the plugs can't be animated.
+  std::vector<MObject> animCurves(numPlugs);
+  for(uint32_t i = 0; i < numPlugs; ++i)
+  {
+    MFnAnimCurve fnCurve;
+    if(!DgNodeHelper::prepareAnimCurve(plugs[i], fnCurve, newAnimCurves))
+    {
+      return MS::kFailure;
+    }
+    animCurves[i] = fnCurve.object();
+  }
+
+  if(!numKeys)
+  {
+    return MS::kSuccess;
+  }
+
+  MTimeArray keyTimes(numKeys, MTime(0.0, MTime::kFilm));
+  for(uint32_t i = 0; i < numKeys; ++i)
+  {
+    keyTimes[i] = MTime(times[i], MTime::kFilm);
+  }
+
+  // the time array is shared by all the curves, only the values get converted for each of them.
+  MDoubleArray keyValues(numKeys);
+  for(uint32_t i = 0; i < numPlugs; ++i)
+  {
+    convertKeyValues(&keyValues[0], values.data() + size_t(i) * numKeys, numKeys, conversionFactor);
+
+    MFnAnimCurve fnCurve(animCurves[i]);
+    AL_MAYA_CHECK_ERROR(fnCurve.addKeys(&keyTimes, &keyValues, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal), errorString);
+  }
+  return MS::kSuccess;
+}
+} // anon
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::setAnimCurves(const MPlugArray& plugs, const std::vector<double>& times, const std::vector<float>& values,
+                                    double conversionFactor, MObjectArray *newAnimCurves)
+{
+  return setAnimCurvesImpl(plugs, times, values, conversionFactor, newAnimCurves);
+}
 
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::setAnimCurves(const MPlugArray& plugs, const std::vector<double>& times, const std::vector<double>& values,
+                                    double conversionFactor, MObjectArray *newAnimCurves)
+{
+  return setAnimCurvesImpl(plugs, times, values, conversionFactor, newAnimCurves);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+MStatus DgNodeHelper::setAngleAnim(MObject node, MObject attr, const UsdGeomXformOp op, MObjectArray *newAnimCurves)
+{
   std::vector<double> times;
   op.GetTimeSamples(&times);
 
-  const float conversionFactor = 0.0174533f;
+  // gather all the samples first, the keys are then added in one go.
+  std::vector<double> keyTimes;
+  std::vector<float> values;
+  keyTimes.reserve(times.size());
+  values.reserve(times.size());
 
   float value = 0;
   for(auto const& timeValue: times)
   {
     const bool retValue = op.GetAs<float>(&value, timeValue);
     if (!retValue) continue;
-
-    MTime tm(timeValue, MTime::kFilm);
-
-    fnCurve.addKey(tm, value * conversionFactor, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, errorString);
+    keyTimes.push_back(timeValue);
+    values.push_back(value);
   }
 
-  return MS::kSuccess;
+  const float conversionFactor = 0.0174533f;
+
+  MPlugArray plugs;
+  plugs.append(MPlug(node, attr));
+  return setAnimCurves(plugs, keyTimes, values, conversionFactor, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1081,29 +1194,26 @@ MStatus DgNodeHelper::setFloatAttrAnim(const MObject node, const MObject attr, U
     return MS::kFailure;
   }
 
-  const char* const errorString = "DgNodeTranslator::setFloatAttrAnim";
-  MStatus status;
-
-  MPlug plug(node, attr);
-  MFnAnimCurve fnCurve;
-  status = prepareAnimCurve(plug, fnCurve, newAnimCurves);
-  if(!status)return MS::kFailure;
-
   std::vector<double> times;
   usdAttr.GetTimeSamples(&times);
 
+  std::vector<double> keyTimes;
+  std::vector<float> values;
+  keyTimes.reserve(times.size());
+  values.reserve(times.size());
+
   float value;
   for(auto const& timeValue: times)
   {
     const bool retValue = usdAttr.Get(&value, timeValue);
     if(!retValue) continue;
-
-    MTime tm(timeValue, MTime::kFilm);
-    fnCurve.addKey(tm, value * conversionFactor, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, errorString);
+    keyTimes.push_back(timeValue);
+    values.push_back(value);
   }
 
-  return MS::kSuccess;
+  MPlugArray plugs;
+  plugs.append(MPlug(node, attr));
+  return setAnimCurves(plugs, keyTimes, values, conversionFactor, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1114,30 +1224,26 @@ MStatus DgNodeHelper::setVisAttrAnim(const MObject node, const MObject attr, con
     return MS::kFailure;
   }
 
-  const char* const errorString = "DgNodeTranslator::setVisAttrAnim: Error adding keyframes";
-  MStatus status;
-
-  MPlug plug(node, attr);
-  MFnAnimCurve fnCurve;
-  status = prepareAnimCurve(plug, fnCurve, newAnimCurves);
-  if(!status)return MS::kFailure;
-
   std::vector<double> times;
   usdAttr.GetTimeSamples(&times);
 
+  std::vector<double> keyTimes;
+  std::vector<float> values;
+  keyTimes.reserve(times.size());
+  values.reserve(times.size());
+
   TfToken value;
   for(auto const& timeValue: times)
   {
     const bool retValue = usdAttr.Get<TfToken>(&value, timeValue);
     if(!retValue) continue;
-
-    MTime tm(timeValue, MTime::kFilm);
-
-    fnCurve.addKey(tm, (value == UsdGeomTokens->invisible) ? 0 : 1, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, errorString);
+    keyTimes.push_back(timeValue);
+    values.push_back((value == UsdGeomTokens->invisible) ? 0.0f : 1.0f);
   }
 
-  return MS::kSuccess;
+  MPlugArray plugs;
+  plugs.append(MPlug(node, attr));
+  return setAnimCurves(plugs, keyTimes, values, 1.0, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1148,22 +1254,15 @@ MStatus DgNodeHelper::setClippingRangeAttrAnim(const MObject node, const MObject
     return MS::kFailure;
   }
 
-  const char* const errorString = "DgNodeTranslator::setClippingRangeAttrAnim: Error adding keyframes";
-  MStatus status;
-
-  MPlug nearPlug(node, nearAttr);
-  MFnAnimCurve fnCurveNear;
-  status = prepareAnimCurve(nearPlug, fnCurveNear, newAnimCurves);
-  if(!status)return MS::kFailure;
-
-  MPlug farPlug(node, farAttr);
-  MFnAnimCurve fnCurveFar;
-  status = prepareAnimCurve(farPlug, fnCurveFar, newAnimCurves);
-  if(!status)return MS::kFailure;
-
   std::vector<double> times;
   usdAttr.GetTimeSamples(&times);
 
+  std::vector<double> keyTimes;
+  std::vector<float> nearValues, farValues;
+  keyTimes.reserve(times.size());
+  nearValues.reserve(times.size());
+  farValues.reserve(times.size());
+
   GfVec2f clippingRange;
   for(auto const& timeValue: times)
   {
@@ -1171,15 +1270,19 @@ MStatus DgNodeHelper::setClippingRangeAttrAnim(const MObject node, const MObject
     {
       continue;
     }
-    MTime tm(timeValue, MTime::kFilm);
-
-    fnCurveNear.addKey(tm, clippingRange[0], MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, errorString);
-    fnCurveFar.addKey(tm, clippingRange[1], MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, errorString);
+    keyTimes.push_back(timeValue);
+    nearValues.push_back(clippingRange[0]);
+    farValues.push_back(clippingRange[1]);
   }
 
-  return MS::kSuccess;
+  // the near keys are followed by the far keys
+  std::vector<float> values(std::move(nearValues));
+  values.insert(values.end(), farValues.begin(), farValues.end());
+
+  MPlugArray plugs;
+  plugs.append(MPlug(node, nearAttr));
+  plugs.append(MPlug(node, farAttr));
+  return setAnimCurves(plugs, keyTimes, values, 1.0, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 #include <maya/MFnAnimCurve.h>
 #include <maya/MGlobal.h>
 #include <maya/MPlug.h>
+#include <maya/MPlugArray.h>
 #include <maya/MTime.h>
 #include <maya/MObjectArray.h>
 
@@ -31,6 +32,8 @@
 #include "AL/maya/utils/MayaHelperMacros.h"
 #include "AL/usdmaya/utils/AttributeType.h"
 
+#include <vector>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace AL {
@@ -1263,6 +1266,28 @@ public:
   AL_USDMAYA_UTILS_PUBLIC
   static MStatus setClippingRangeAttrAnim(const MObject node, const MObject nearAttr, const MObject farAttr, const UsdAttribute & usdAttr, MObjectArray *newAnimCurves=nullptr);
 
+  /// \brief  creates animation curves in maya for many plugs at once. All the key frames of a curve are added with a
+  ///         single MFnAnimCurve::addKeys call, and the values are scaled in bulk.
+  /// \param  plugs the plugs to animate
+  /// \param  times the key frame times, shared by all the plugs
+  /// \param  values the key frame values. The values of each plug follow the values of the previous plug, i.e. the
+  ///         value of plugs[i] at times[j] is values[i * times.size() + j].
+  /// \param  conversionFactor a scaling to apply to the key frames on import
+  /// \param  newAnimCurves The MObjectArray to contain possibly created animCurve nodes.
+  /// \return MS::kSuccess on success, error code otherwise
+  AL_USDMAYA_UTILS_PUBLIC
+  static MStatus setAnimCurves(const MPlugArray& plugs, const std::vector<double>& times, const std::vector<float>& values, double conversionFactor = 1.0, MObjectArray *newAnimCurves=nullptr);
+
+  /// \brief  creates animation curves in maya for many plugs at once, from double precision values.
+  /// \param  plugs the plugs to animate
+  /// \param  times the key frame times, shared by all the plugs
+  /// \param  values the key frame values, laid out as in the single precision overload.
+  /// \param  conversionFactor a scaling to apply to the key frames on import
+  /// \param  newAnimCurves The MObjectArray to contain possibly created animCurve nodes.
+  /// \return MS::kSuccess on success, error code otherwise
+  AL_USDMAYA_UTILS_PUBLIC
+  static MStatus setAnimCurves(const MPlugArray& plugs, const std::vector<double>& times, const std::vector<double>& values, double conversionFactor = 1.0, MObjectArray *newAnimCurves=nullptr);
+
   /// \brief  check if an animation curves type is supported for DgNodeHelper::set*Anim functions.
   /// \param  animCurveFn the MFnAnimCurve object that holds a animCurve MObject.
   /// \return MS::kSuccess if it is supported, error code otherwise
@@ -1994,16 +2019,20 @@ MStatus DgNodeHelper::setVec3Anim(MObject node, MObject attr, const UsdGeomXform
   std::vector<double> times;
   op.GetTimeSamples(&times);
 
+  std::vector<double> keyTimes;
   VtArray<T> values;
+  keyTimes.reserve(times.size());
+  values.reserve(times.size());
   T value(0);
   for(auto const& timeValue: times)
   {
     const bool retValue = op.GetAs<T>(&value, timeValue);
     if (!retValue) continue;
+    keyTimes.push_back(timeValue);
     values.push_back(value);
   }
 
-  return setVec3Anim<T>(node, attr, times, values, conversionFactor, newAnimCurves);
+  return setVec3Anim<T>(node, attr, keyTimes, values, conversionFactor, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2011,34 +2040,25 @@ template<typename T>
 MStatus DgNodeHelper::setVec3Anim(MObject node, MObject attr, const std::vector<double>& times, VtArray<T>& values, double conversionFactor, MObjectArray *newAnimCurves)
 {
   MPlug plug(node, attr);
-  MStatus status;
-
-  MFnAnimCurve xFn, yFn, zFn;
-  status = prepareAnimCurve(plug.child(0), xFn, newAnimCurves);
-  if(!status)return MS::kFailure;
-
-  status = prepareAnimCurve(plug.child(1), yFn, newAnimCurves);
-  if(!status)return MS::kFailure;
-
-  status = prepareAnimCurve(plug.child(2), zFn, newAnimCurves);
-  if(!status)return MS::kFailure;
+  if(values.size() != times.size())
+    return MS::kFailure;
 
-  const char* const xformErrorEdit = "DgNodeTranslator:setVec3Anim error setting animation curve";
-  size_t timeIndex = 0;
-  for(auto const& timeValue: times)
+  // split the vectors into the x, y and z keys, which are then added to their curves in one go.
+  const size_t numKeys = times.size();
+  std::vector<double> keyValues(numKeys * 3);
+  for(size_t i = 0; i < numKeys; ++i)
   {
-    MTime tm(timeValue, MTime::kFilm);
-    T &value =  values[timeIndex];
-    xFn.addKey(tm, value[0] * conversionFactor, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, xformErrorEdit); 
-    yFn.addKey(tm, value[1] * conversionFactor, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, xformErrorEdit); 
-    zFn.addKey(tm, value[2] * conversionFactor, MFnAnimCurve::kTangentGlobal, MFnAnimCurve::kTangentGlobal, NULL, &status);
-    AL_MAYA_CHECK_ERROR(status, xformErrorEdit); 
-    timeIndex ++;
+    const T& value = values[i];
+    keyValues[i] = value[0];
+    keyValues[numKeys + i] = value[1];
+    keyValues[2 * numKeys + i] = value[2];
   }
 
-  return MS::kSuccess;
+  MPlugArray plugs;
+  plugs.append(plug.child(0));
+  plugs.append(plug.child(1));
+  plugs.append(plug.child(2));
+  return setAnimCurves(plugs, times, keyValues, conversionFactor, newAnimCurves);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
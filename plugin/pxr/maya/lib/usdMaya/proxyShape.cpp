@@ -263,7 +263,7 @@ UsdMayaProxyShape::setInternalValueInContext(
         return true;
     }
 
-    return MPxSurfaceShape::setInternalValueInContext(plug, dataHandle, ctx);
+    return MayaUsdProxyShapeBase::setInternalValueInContext(plug, dataHandle, ctx);
 }
 
 /* virtual */
@@ -278,7 +278,7 @@ UsdMayaProxyShape::getInternalValueInContext(
         return true;
     }
 
-    return MPxSurfaceShape::getInternalValueInContext(plug, dataHandle, ctx);
+    return MayaUsdProxyShapeBase::getInternalValueInContext(plug, dataHandle, ctx);
 }
 
 UsdMayaProxyShape::UsdMayaProxyShape() :
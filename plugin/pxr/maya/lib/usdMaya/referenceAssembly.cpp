@@ -31,7 +31,6 @@
 #include <pxr/base/tf/stringUtils.h>
 
 #include <pxr/usd/ar/resolver.h>
-#include <pxr/usd/usd/editContext.h>
 #include <pxr/usd/usd/editTarget.h>
 #include <pxr/usd/usd/stageCacheContext.h>
 #include <pxr/usd/usd/variantSets.h>
@@ -54,7 +53,6 @@
 #include <maya/MFnTypedAttribute.h>
 #include <maya/MFnUnitAttribute.h>
 #include <maya/MGlobal.h>
-#include <maya/MItEdits.h>
 #include <maya/MItSelectionList.h>
 #include <maya/MNamespace.h>
 #include <maya/MPlugArray.h>
@@ -64,6 +62,7 @@
 #include <algorithm>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -274,8 +273,7 @@ UsdMayaReferenceAssembly::initialize()
 UsdMayaReferenceAssembly::UsdMayaReferenceAssembly() :
     _updatingRepNamespace(false),
     _activateRepOnFileLoad(false),
-    _inSetInternalValue(false),
-    _hasEdits(false)
+    _inSetInternalValue(false)
 {
     TfRegistryManager::GetInstance().SubscribeTo<UsdMayaReferenceAssembly>();
 
@@ -592,14 +590,37 @@ MStatus UsdMayaReferenceAssembly::compute(const MPlug& aPlug,
     return MS::kSuccess;
 }
 
-static
-MItEdits
-_GetEdits(
-        const MObject& assemObj)
+/* static */
+std::string
+UsdMayaReferenceAssembly::ComputeEditsKey(
+        const SdfLayerHandle& rootLayer,
+        const UsdMayaEditUtil::PathEditMap& assemEdits)
 {
-    MObject editsOwner(assemObj);
-    MObject targetNode(assemObj);
-    return MItEdits(editsOwner, targetNode);
+    if (assemEdits.empty()) {
+        return std::string();
+    }
+
+    // The edit strings name the assembly node, so the key is built from the
+    // parsed edits, which are relative to the root of the assembly.
+    // Example key: "/root.usd|Geom{0,-1,(1, 2, 3);}"
+    std::ostringstream key;
+    key << rootLayer->GetIdentifier() << "|";
+    for (const auto& pathEdits : assemEdits) {
+        key << pathEdits.first << "{";
+        for (const auto& edit : pathEdits.second) {
+            key << edit.op << "," << edit.set << ",";
+            if (edit.value.IsHolding<double>()) {
+                // Streaming a double VtValue loses precision.
+                key << TfStringify(edit.value.UncheckedGet<double>());
+            }
+            else {
+                key << edit.value;
+            }
+            key << ";";
+        }
+        key << "}";
+    }
+    return key.str();
 }
 
 static
@@ -710,26 +731,40 @@ UsdMayaReferenceAssembly::computeInStageDataCached(MDataBlock& dataBlock)
                 drawMode = TfToken(drawModePlug.asString().asChar());
             }
 
-            SdfLayerRefPtr sessionLayer =
-                    UsdMayaStageCache::GetSharedSessionLayer(
-                        SdfPath::AbsoluteRootPath().AppendChild(modelName),
-                        varSels,
-                        drawMode);
-
             // If we have assembly edits, do not share session layers with
             // other models that have our same set of variant selections,
-            // since our edits may differ from theirs. Theoretically we
-            // could hash all of our edit strings and share the same usd
-            // stage as other models with the same hash, but it's not
-            // typical to have enough models in a scene that share the same
-            // set of edits in order to make that worthwhile.
-            MObject assemObj = thisMObject();
-            MItEdits itAssemEdits(_GetEdits(assemObj));
-            if (!itAssemEdits.isDone()) {
-                _hasEdits = true;
-                SdfLayerRefPtr unsharedSessionLayer = SdfLayer::CreateAnonymous();
-                unsharedSessionLayer->TransferContent(sessionLayer);
-                sessionLayer = unsharedSessionLayer;
+            // since our edits may differ from theirs. The edits are authored
+            // in a session layer shared by the models with the same edits
+            // instead, so that they still share the same usd stage. Layouts
+            // where most models carry a small tweak then compose one stage
+            // per distinct set of edits rather than one per edited model.
+            // The unedited composition itself is not shared across sets of
+            // edits: a usd stage composes its whole layer stack, and a
+            // per-model overlay on a single stage would have to be resolved
+            // by the proxy shape draw and query paths instead.
+            const SdfPath modelPath =
+                SdfPath::AbsoluteRootPath().AppendChild(modelName);
+            UsdMayaEditUtil::PathEditMap assemEdits;
+            std::vector<std::string> invalidEdits;
+            UsdMayaEditUtil::GetEditsForAssembly(
+                thisMObject(), &assemEdits, &invalidEdits);
+            _editsKey = ComputeEditsKey(rootLayer, assemEdits);
+
+            SdfLayerRefPtr sessionLayer;
+            bool applyEdits = false;
+            if (_editsKey.empty()) {
+                sessionLayer = UsdMayaStageCache::GetSharedSessionLayer(
+                    modelPath,
+                    varSels,
+                    drawMode);
+            }
+            else {
+                sessionLayer = UsdMayaStageCache::GetSharedEditedSessionLayer(
+                    modelPath,
+                    varSels,
+                    drawMode,
+                    _editsKey,
+                    &applyEdits);
             }
 
             const bool loadAll = true;
@@ -746,6 +781,29 @@ UsdMayaReferenceAssembly::computeInStageDataCached(MDataBlock& dataBlock)
                 // Preserving prior behavior for now-- eventually might make
                 // more sense to bail in this case.
                 SdfPath::AbsoluteRootPath();
+
+            // The first model using a new set of edits authors them for all
+            // the models sharing the session layer.
+            if (applyEdits) {
+                const UsdPrim proxyRootPrim = usdStage->GetPrimAtPath(primPath);
+
+                std::vector<std::string> failedEdits;
+                UsdMayaEditUtil::ApplyEditsToProxy(
+                    assemEdits,
+                    proxyRootPrim,
+                    &failedEdits);
+
+                if (!failedEdits.empty()) {
+                    TF_WARN(
+                        "The following assembly edits could not be applied "
+                        "under the USD prim '%s' for %s node '%s':\n"
+                        "    %s",
+                        primPath.GetText(),
+                        UsdMayaReferenceAssemblyTokens->MayaTypeName.GetText(),
+                        dagNodeFn.fullPathName().asChar(),
+                        TfStringJoin(failedEdits, "\n    ").c_str());
+                }
+            }
         }
 
         // If fileString is non-empty but we couldn't create a stage from there,
@@ -1266,21 +1324,6 @@ UsdMayaRepresentationProxyBase::_PushEditsToProxy()
     UsdMayaReferenceAssembly* usdAssem =
         dynamic_cast<UsdMayaReferenceAssembly*>(getAssembly());
     const MFnAssembly assemblyFn(assemObj);
-    MItEdits itAssemEdits(_GetEdits(assemObj));
-    const bool hasEdits = !itAssemEdits.isDone();
-    if (usdAssem->HasEdits() != hasEdits) {
-        usdAssem->SetHasEdits(hasEdits);
-
-        // If we now have edits but previous did not, or vice versa, make sure
-        // we invalidate our UsdStage so that we are not sharing with other
-        // model instances that do not have edits.
-        MGlobal::executeCommand("dgdirty " + assemblyFn.partialPathName());
-    }
-
-    const UsdPrim proxyRootPrim = usdAssem->usdPrim();
-    if (!proxyRootPrim) {
-        return;
-    }
 
     UsdMayaEditUtil::PathEditMap assemEdits;
     std::vector<std::string> invalidEdits;
@@ -1296,50 +1339,19 @@ UsdMayaRepresentationProxyBase::_PushEditsToProxy()
             TfStringJoin(invalidEdits, "\n    ").c_str());
     }
 
-    if (!assemEdits.empty()) {
-        // Create an anonymous layer to hold the assembly edit opinions, and
-        // sublayer it into the stage's session layer.
-        const UsdStagePtr stage = proxyRootPrim.GetStage();
-        _sessionSublayer = SdfLayer::CreateAnonymous();
-        stage->GetSessionLayer()->GetSubLayerPaths().clear();
-        stage->GetSessionLayer()->GetSubLayerPaths().push_back(
-            _sessionSublayer->GetIdentifier());
-
-        // Make the session sublayer the edit target before applying the Maya
-        // edits to ensure that we don't pollute other assemblies using the
-        // same layer(s).
-        UsdEditContext editContext(stage, _sessionSublayer);
-
-        std::vector<std::string> failedEdits;
-        UsdMayaEditUtil::ApplyEditsToProxy(
-            assemEdits,
-            proxyRootPrim,
-            &failedEdits);
-
-        if (!failedEdits.empty()) {
-            TF_WARN(
-                "The following assembly edits could not be applied under the "
-                "USD prim '%s' for %s node '%s':\n"
-                "    %s",
-                proxyRootPrim.GetPath().GetText(),
-                UsdMayaReferenceAssemblyTokens->MayaTypeName.GetText(),
-                assemblyFn.fullPathName().asChar(),
-                TfStringJoin(failedEdits, "\n    ").c_str());
-        }
+    const UsdPrim proxyRootPrim = usdAssem->usdPrim();
+    if (!proxyRootPrim) {
+        return;
     }
-}
 
-bool UsdMayaRepresentationProxyBase::inactivate()
-{
-    // Clear out session sublayer and remove it from the layer stack, to avoid
-    // polluting other representations of the same stage.
-    UsdPrim proxyRootPrim = dynamic_cast<UsdMayaReferenceAssembly*>(getAssembly())->usdPrim();
-    if (proxyRootPrim) {
-        proxyRootPrim.GetStage()->GetSessionLayer()->GetSubLayerPaths().clear();
-        _sessionSublayer = SdfLayerRefPtr();
+    // The edits are authored when the stage gets computed. If they changed
+    // since then, invalidate our UsdStage so that we switch to the stage
+    // shared by the model instances with our new set of edits.
+    const std::string editsKey = UsdMayaReferenceAssembly::ComputeEditsKey(
+        proxyRootPrim.GetStage()->GetRootLayer(), assemEdits);
+    if (usdAssem->GetEditsKey() != editsKey) {
+        MGlobal::executeCommand("dgdirty " + assemblyFn.partialPathName());
     }
-
-    return UsdMayaRepresentationBase::inactivate();
 }
 
 void
@@ -19,6 +19,7 @@
 /// \file usdMaya/referenceAssembly.h
 
 #include "usdMaya/api.h"
+#include "usdMaya/editUtil.h"
 #include "usdMaya/proxyShape.h"
 #include <mayaUsd/nodes/usdPrimProvider.h>
 
@@ -199,8 +200,20 @@ public:
     UsdPrim usdPrim() const override;
 
     // Additional public functions
-    bool HasEdits() const { return _hasEdits; }
-    void SetHasEdits(bool val) { _hasEdits = val; }
+    bool HasEdits() const { return !_editsKey.empty(); }
+
+    /// Returns the string identifying the edits applied to the stage of the
+    /// assembly, empty if the assembly has no edits. Assemblies with the same
+    /// edits key share the same stage. Assemblies with different edits keys
+    /// compose separate stages, even if they only differ by a single edit.
+    const std::string& GetEditsKey() const { return _editsKey; }
+
+    /// Returns the string identifying the edits \p assemEdits when applied
+    /// to a stage with the root layer \p rootLayer.
+    PXRUSDMAYA_API
+    static std::string ComputeEditsKey(
+            const SdfLayerHandle& rootLayer,
+            const UsdMayaEditUtil::PathEditMap& assemEdits);
 
     /// This method returns a map of variantSet names to variant selections based
     /// on the variant selections specified on the Maya assembly node. The list
@@ -269,7 +282,7 @@ public:
     bool _activateRepOnFileLoad;
     std::shared_ptr<MPxRepresentation> _activeRep;
     bool _inSetInternalValue;
-    bool _hasEdits;
+    std::string _editsKey;
 };
 
 
@@ -314,8 +327,6 @@ class UsdMayaRepresentationProxyBase : public UsdMayaRepresentationBase
 
     PXRUSDMAYA_API
     bool activate() override;
-    PXRUSDMAYA_API
-    bool inactivate() override;
 
   protected:
     PXRUSDMAYA_API
@@ -327,7 +338,6 @@ class UsdMayaRepresentationProxyBase : public UsdMayaRepresentationBase
     void _PushEditsToProxy();
 
   private:
-    SdfLayerRefPtr _sessionSublayer;
     bool _proxyIsSoftSelectable;
 };
 
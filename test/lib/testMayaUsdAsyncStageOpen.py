@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import shutil
+import tempfile
+import time
+import unittest
+
+import maya.cmds as cmds
+import maya.utils
+
+from mayaUsd import lib as mayaUsdLib
+
+from pxr import Usd, UsdGeom
+
+@unittest.skipUnless(os.environ.get('MAYAUSD_ASYNC_STAGE_OPEN', '0') not in ('', '0'),
+                     "Requires MAYAUSD_ASYNC_STAGE_OPEN to open stages on worker threads")
+class testMayaUsdAsyncStageOpen(unittest.TestCase):
+    """
+    Tests opening the stages of proxy shapes on worker threads.
+    """
+
+    # Number of stages opened at the same time.
+    STAGE_COUNT = 4
+
+    # Maximum time to wait for the stages to be opened, in seconds.
+    TIMEOUT = 60.0
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+        cls._tempDir = tempfile.mkdtemp()
+        cls._usdFilePaths = []
+        for stageIndex in range(cls.STAGE_COUNT):
+            filePath = os.path.join(cls._tempDir, 'stage%d.usda' % stageIndex)
+            stage = Usd.Stage.CreateNew(filePath)
+            for primIndex in range(100):
+                UsdGeom.Xform.Define(stage, '/Root/Xform%d' % primIndex)
+            stage.Save()
+            cls._usdFilePaths.append(filePath)
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls._tempDir, ignore_errors=True)
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+        mayaUsdLib.StageCache.Clear()
+
+    def _CreateProxyShape(self, filePath):
+        proxyShape = cmds.createNode('mayaUsdProxyShape')
+        cmds.setAttr('%s.filePath' % proxyShape, filePath, type='string')
+        return cmds.ls(proxyShape, long=True)[0]
+
+    def _WaitForStages(self, proxyShapes):
+        """
+        Processes the idle queue, where proxy shapes get dirtied once their
+        stage is opened, until all the proxy shapes have a stage.
+        """
+        start = time.time()
+        while time.time() - start < self.TIMEOUT:
+            maya.utils.processIdleEvents()
+            prims = [mayaUsdLib.GetPrim(proxyShape) for proxyShape in proxyShapes]
+            if all(prims):
+                return [prim.GetStage() for prim in prims]
+            time.sleep(0.05)
+
+        self.fail('Stages were not opened after %.0f seconds' % self.TIMEOUT)
+
+    def testOpenStages(self):
+        """
+        Stages opened at the same time on worker threads are each inserted in
+        the stage cache.
+        """
+        proxyShapes = [self._CreateProxyShape(filePath)
+                       for filePath in self._usdFilePaths]
+
+        stages = self._WaitForStages(proxyShapes)
+
+        stageCache = mayaUsdLib.StageCache.Get(True)
+        for filePath, stage in zip(self._usdFilePaths, stages):
+            self.assertTrue(stageCache.Contains(stage))
+            self.assertEqual(os.path.normcase(stage.GetRootLayer().realPath),
+                             os.path.normcase(filePath))
+            self.assertTrue(stage.GetPrimAtPath('/Root/Xform99'))
+
+        self.assertEqual(len(set(stage.GetRootLayer().identifier
+                                 for stage in stages)), self.STAGE_COUNT)
+
+    def testShareStage(self):
+        """
+        Proxy shapes of the same file share a single stage, whether they are
+        created while it is being opened or once it is in the stage cache.
+        """
+        filePath = self._usdFilePaths[0]
+        proxyShapes = [self._CreateProxyShape(filePath) for _ in range(2)]
+        stages = self._WaitForStages(proxyShapes)
+        self.assertEqual(stages[0], stages[1])
+
+        # Stages in the stage cache are returned right away.
+        proxyShape = self._CreateProxyShape(filePath)
+        self.assertEqual(mayaUsdLib.GetPrim(proxyShape).GetStage(), stages[0])
+
+        stageCache = mayaUsdLib.StageCache.Get(True)
+        self.assertEqual(len(stageCache.FindAllMatching(stages[0].GetRootLayer())), 1)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
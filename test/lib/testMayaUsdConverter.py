@@ -225,3 +225,65 @@ class MayaUsdConverterTestCase(unittest.TestCase):
         self.runTypeChecks(sdfValueType,value1,value2)
         self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
         
+
+    def testFloatArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.FloatArray
+        """
+        #
+        value1 = Vt.FloatArray([1.5,2.5,3.5])
+        value2 = Vt.FloatArray([4.5,5.5])
+        sdfValueType = Sdf.ValueTypeNames.FloatArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testDoubleArrayConverter(self):
+        """
+        Test for Sdf.ValueTypeNames.DoubleArray
+        """
+        #
+        value1 = Vt.DoubleArray([1.25,2.25,3.25])
+        value2 = Vt.DoubleArray([4.25,5.25])
+        sdfValueType = Sdf.ValueTypeNames.DoubleArray
+        errSdfValueType = Sdf.ValueTypeNames.String
+        #
+        self.runTypeChecks(sdfValueType,value1,value2)
+        self.runErrorHandlingChecks(sdfValueType,value1,errSdfValueType)
+
+    def testArrayConverterRoundTrip(self):
+        """
+        Round-trip arrays through plugs and verify every element, converting
+        from the USD attribute to the plug and back to a cleared attribute.
+        """
+        elementCount = 7
+        values = [
+            (Sdf.ValueTypeNames.IntArray, Vt.IntArray([i * 3 - 5 for i in range(elementCount)])),
+            (Sdf.ValueTypeNames.FloatArray, Vt.FloatArray([i * 0.5 - 1.0 for i in range(elementCount)])),
+            (Sdf.ValueTypeNames.DoubleArray, Vt.DoubleArray([i * 0.25 + 0.125 for i in range(elementCount)])),
+            (Sdf.ValueTypeNames.Point3fArray, Vt.Vec3fArray([Gf.Vec3f(i, -i, i * 0.5) for i in range(elementCount)])),
+        ]
+
+        for sdfValueType, value in values:
+            cmds.file(new=True, force=True)
+            stage = self.createStage("layer"+str(sdfValueType).replace('[]','Array'))
+            plug, attr = self.createMPlugAndUsdAttribute(sdfValueType, "group1", stage, "/Foo")
+            attr.Set(value)
+
+            args = mayaUsdLib.ConverterArgs()
+            converter = mayaUsdLib.Converter.find(plug, attr)
+            self.assertNotEqual(converter, None)
+
+            converter.convert(attr, plug, args)
+            plugValue = converter.convertVt(plug, args)
+            self.assertEqual(len(plugValue), elementCount)
+            for i in range(elementCount):
+                self.assertEqual(plugValue[i], value[i])
+
+            attr.Clear()
+            converter.convert(plug, attr, args)
+            result = attr.Get()
+            self.assertEqual(len(result), elementCount)
+            for i in range(elementCount):
+                self.assertEqual(result[i], value[i])
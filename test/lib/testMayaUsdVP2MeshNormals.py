@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+from pxr import Gf, Vt
+
+from mayaUsd import lib as mayaUsdLib
+
+import unittest
+
+class testMayaUsdVP2MeshNormals(unittest.TestCase):
+    """
+    Verify the vertex adjacency shared by VP2 meshes with the same topology,
+    and the smooth normals computed from it.
+    """
+
+    # Cube of 8 points, point i being at -1 or 1 along X, Y and Z for its
+    # bits 0, 1 and 2. Faces are wound counter-clockwise seen from outside.
+    CUBE_FACE_VERTEX_COUNTS = Vt.IntArray([4] * 6)
+    CUBE_FACE_VERTEX_INDICES = Vt.IntArray([
+        0, 2, 3, 1,
+        4, 5, 7, 6,
+        0, 1, 5, 4,
+        2, 6, 7, 3,
+        0, 4, 6, 2,
+        1, 3, 7, 5])
+
+    @staticmethod
+    def _CubePoints(offset=Gf.Vec3f(0.0)):
+        return Vt.Vec3fArray([
+            Gf.Vec3f(
+                1.0 if i & 1 else -1.0,
+                1.0 if i & 2 else -1.0,
+                1.0 if i & 4 else -1.0) + offset
+            for i in range(8)])
+
+    def _GetCubeAdjacency(self, registry):
+        return registry.GetVertexAdjacency(
+            self.CUBE_FACE_VERTEX_COUNTS, self.CUBE_FACE_VERTEX_INDICES)
+
+    def _AssertCubeNormals(self, normals):
+        self.assertEqual(len(normals), 8)
+        for point, normal in zip(self._CubePoints(), normals):
+            self.assertTrue(Gf.IsClose(
+                normal.GetNormalized(), point.GetNormalized(), 1e-5),
+                '%s != %s' % (normal, point))
+
+    def testSharedAdjacency(self):
+        """
+        Meshes with the same topology get the same adjacency table, meshes
+        with another topology get their own.
+        """
+        registry = mayaUsdLib.ResourceRegistry()
+
+        cubeAdjacency = self._GetCubeAdjacency(registry)
+        self.assertEqual(cubeAdjacency, self._GetCubeAdjacency(registry))
+
+        quadAdjacency = registry.GetVertexAdjacency(
+            Vt.IntArray([4]), Vt.IntArray([0, 1, 2, 3]))
+        self.assertNotEqual(cubeAdjacency, quadAdjacency)
+
+        # Tables are not shared across render delegates.
+        otherRegistry = mayaUsdLib.ResourceRegistry()
+        self.assertNotEqual(cubeAdjacency,
+                            self._GetCubeAdjacency(otherRegistry))
+
+    def testSmoothNormals(self):
+        """
+        Smooth normals computed from a shared adjacency are correct for each
+        mesh, i.e. they point away from the cube center at every corner.
+        """
+        registry = mayaUsdLib.ResourceRegistry()
+
+        firstAdjacency = self._GetCubeAdjacency(registry)
+        secondAdjacency = self._GetCubeAdjacency(registry)
+        self.assertEqual(firstAdjacency, secondAdjacency)
+
+        self._AssertCubeNormals(
+            firstAdjacency.ComputeSmoothNormals(self._CubePoints()))
+        self._AssertCubeNormals(
+            secondAdjacency.ComputeSmoothNormals(
+                self._CubePoints(Gf.Vec3f(5.0, -2.0, 3.0))))
+
+        # A flat quad only has normals along Z.
+        quadAdjacency = registry.GetVertexAdjacency(
+            Vt.IntArray([4]), Vt.IntArray([0, 1, 2, 3]))
+        quadNormals = quadAdjacency.ComputeSmoothNormals(Vt.Vec3fArray([
+            Gf.Vec3f(0, 0, 0), Gf.Vec3f(1, 0, 0),
+            Gf.Vec3f(1, 1, 0), Gf.Vec3f(0, 1, 0)]))
+        for normal in quadNormals:
+            self.assertTrue(Gf.IsClose(
+                normal.GetNormalized(), Gf.Vec3f(0, 0, 1), 1e-5))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,222 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import shutil
+import tempfile
+import unittest
+
+import maya.cmds as cmds
+from maya.app.general.mayaIsVP2Capable import mayaIsVP2Capable
+
+from mayaUsd import lib as mayaUsdLib
+from mayaUsd.lib import PlaybackCache
+
+from pxr import Gf, Sdf, Usd, UsdGeom, Vt
+
+def _QuadPoints(z):
+    return Vt.Vec3fArray([
+        Gf.Vec3f(0, 0, z), Gf.Vec3f(1, 0, z),
+        Gf.Vec3f(1, 1, z), Gf.Vec3f(0, 1, z)])
+
+class testMayaUsdVP2PlaybackCache(unittest.TestCase):
+    """
+    Tests the recording and the invalidation of vertex buffer data by the
+    playback cache of the VP2 render delegate.
+    """
+
+    RPRIM_ID = Sdf.Path('/Quad')
+    POINTS = 'points'
+
+    # Size of the points of a quad in bytes.
+    QUAD_SIZE = 4 * 3 * 4
+
+    def setUp(self):
+        PlaybackCache.ResetGlobalStats()
+
+    def _Find(self, cache, frame, numPoints=4):
+        return cache.Find(self.RPRIM_ID, self.POINTS, Usd.TimeCode(frame),
+                          numPoints)
+
+    def _Store(self, cache, frame, points):
+        cache.Store(self.RPRIM_ID, self.POINTS, Usd.TimeCode(frame), points)
+
+    def testRecordedDataHits(self):
+        """
+        Data recorded during playback is found for the same frame and size.
+        """
+        cache = PlaybackCache(1 << 20)
+
+        # Nothing is recorded nor found outside of playback.
+        self._Store(cache, 1, _QuadPoints(1))
+        self.assertEqual(cache.GetMemoryUsage(), 0)
+        self.assertEqual(len(self._Find(cache, 1)), 0)
+
+        cache.SetActive(True)
+        self.assertEqual(len(self._Find(cache, 1)), 0)
+
+        self._Store(cache, 1, _QuadPoints(1))
+        self._Store(cache, 2, _QuadPoints(2))
+        self.assertEqual(cache.GetMemoryUsage(), 2 * self.QUAD_SIZE)
+
+        self.assertEqual(self._Find(cache, 1), _QuadPoints(1))
+        self.assertEqual(self._Find(cache, 2), _QuadPoints(2))
+
+        # Data recorded for another topology doesn't match.
+        self.assertEqual(len(self._Find(cache, 1, numPoints=3)), 0)
+
+        stats = PlaybackCache.GetGlobalStats()
+        self.assertEqual(stats.stores, 2)
+        self.assertEqual(stats.hits, 2)
+        self.assertEqual(stats.misses, 2)
+
+        # Recorded data is kept for the next playback.
+        cache.SetActive(False)
+        cache.SetActive(True)
+        self.assertEqual(self._Find(cache, 2), _QuadPoints(2))
+
+    def testClearInvalidates(self):
+        """
+        Clearing the cache drops the recorded data, which gets recorded again
+        at the next playback.
+        """
+        cache = PlaybackCache(1 << 20)
+        cache.SetActive(True)
+
+        self._Store(cache, 1, _QuadPoints(1))
+        cache.Clear()
+
+        self.assertEqual(cache.GetMemoryUsage(), 0)
+        self.assertEqual(len(self._Find(cache, 1)), 0)
+        self.assertEqual(PlaybackCache.GetGlobalStats().clears, 1)
+
+        self._Store(cache, 1, _QuadPoints(5))
+        self.assertEqual(self._Find(cache, 1), _QuadPoints(5))
+
+    def testBudget(self):
+        """
+        Recording stops once the budget is reached, until the cache is cleared.
+        """
+        cache = PlaybackCache(self.QUAD_SIZE)
+        cache.SetActive(True)
+
+        self._Store(cache, 1, _QuadPoints(1))
+        self.assertTrue(cache.IsRecording())
+
+        self._Store(cache, 2, _QuadPoints(2))
+        self.assertFalse(cache.IsRecording())
+        self.assertEqual(len(self._Find(cache, 2)), 0)
+        self.assertEqual(self._Find(cache, 1), _QuadPoints(1))
+
+        cache.Clear()
+        self.assertTrue(cache.IsRecording())
+
+
+@unittest.skipIf(cmds.about(batch=True) or not mayaIsVP2Capable(),
+                 "Requires a GUI and a valid VP2")
+@unittest.skipUnless(int(os.environ.get('MAYAUSD_VP2_PLAYBACK_CACHE_MB', 0)) > 0,
+                     "Requires MAYAUSD_VP2_PLAYBACK_CACHE_MB to enable the playback cache")
+class testMayaUsdVP2PlaybackCacheDraw(unittest.TestCase):
+    """
+    Tests the playback cache of the VP2 render delegate while playing a
+    deforming mesh.
+    """
+
+    FRAME_COUNT = 10
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+        cls._tempDir = tempfile.mkdtemp()
+        cls._usdFilePath = os.path.join(cls._tempDir, 'deformingQuad.usd')
+
+        stage = Usd.Stage.CreateNew(cls._usdFilePath)
+        stage.SetStartTimeCode(1)
+        stage.SetEndTimeCode(cls.FRAME_COUNT)
+
+        mesh = UsdGeom.Mesh.Define(stage, '/Quad')
+        mesh.CreateFaceVertexCountsAttr(Vt.IntArray([4]))
+        mesh.CreateFaceVertexIndicesAttr(Vt.IntArray([0, 1, 2, 3]))
+        pointsAttr = mesh.CreatePointsAttr()
+        for frame in range(1, cls.FRAME_COUNT + 1):
+            pointsAttr.Set(_QuadPoints(frame), frame)
+
+        stage.Save()
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls._tempDir, ignore_errors=True)
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        proxyShape = cmds.createNode('mayaUsdProxyShape')
+        cmds.setAttr('%s.filePath' % proxyShape, self._usdFilePath, type='string')
+        cmds.connectAttr('time1.outTime', '%s.time' % proxyShape)
+        self._stage = mayaUsdLib.GetPrim(proxyShape).GetStage()
+
+        # Play every frame, so that every frame gets recorded.
+        cmds.playbackOptions(minTime=1, maxTime=self.FRAME_COUNT, loop='once',
+                             playbackSpeed=0)
+        cmds.currentTime(1)
+        cmds.refresh(force=True)
+
+        PlaybackCache.ResetGlobalStats()
+
+    def testLoopedPlaybackHits(self):
+        """
+        The first playback records the vertex buffers, the next one copies
+        them from the recorded data.
+        """
+        cmds.play(forward=True, wait=True)
+
+        stats = PlaybackCache.GetGlobalStats()
+        self.assertGreater(stats.stores, 0)
+        self.assertEqual(stats.hits, 0)
+
+        cmds.currentTime(1)
+        cmds.play(forward=True, wait=True)
+
+        stats = PlaybackCache.GetGlobalStats()
+        self.assertGreater(stats.hits, 0)
+
+    def testEditInvalidates(self):
+        """
+        Editing the stage drops the recorded data, so the next playback draws
+        the edited points instead of the recorded ones.
+        """
+        cmds.play(forward=True, wait=True)
+        cmds.currentTime(1)
+
+        pointsAttr = UsdGeom.Mesh(self._stage.GetPrimAtPath('/Quad')).GetPointsAttr()
+        pointsAttr.Set(_QuadPoints(20), 5)
+        cmds.refresh(force=True)
+
+        self.assertEqual(PlaybackCache.GetGlobalStats().clears, 1)
+
+        PlaybackCache.ResetGlobalStats()
+        cmds.play(forward=True, wait=True)
+
+        stats = PlaybackCache.GetGlobalStats()
+        self.assertEqual(stats.hits, 0)
+        self.assertGreater(stats.stores, 0)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
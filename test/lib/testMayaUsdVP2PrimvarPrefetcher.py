@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import shutil
+import tempfile
+import unittest
+
+import maya.cmds as cmds
+from maya.app.general.mayaIsVP2Capable import mayaIsVP2Capable
+
+from mayaUsd.lib import PrimvarPrefetcher
+
+from pxr import Gf, Usd, UsdGeom, Vt
+
+@unittest.skipIf(cmds.about(batch=True) or not mayaIsVP2Capable(),
+                 "Requires a GUI and a valid VP2")
+@unittest.skipUnless(int(os.environ.get('MAYAUSD_VP2_PREFETCH_FRAMES', 0)) > 0,
+                     "Requires MAYAUSD_VP2_PREFETCH_FRAMES to enable prefetching")
+class testMayaUsdVP2PrimvarPrefetcher(unittest.TestCase):
+    """
+    Tests prefetching of the points of the next frames during playback in the
+    VP2 render delegate.
+    """
+
+    FRAME_COUNT = 10
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+        cls._tempDir = tempfile.mkdtemp()
+        cls._usdFilePath = os.path.join(cls._tempDir, 'deformingQuad.usd')
+
+        stage = Usd.Stage.CreateNew(cls._usdFilePath)
+        stage.SetStartTimeCode(1)
+        stage.SetEndTimeCode(cls.FRAME_COUNT)
+
+        mesh = UsdGeom.Mesh.Define(stage, '/Quad')
+        mesh.CreateFaceVertexCountsAttr(Vt.IntArray([4]))
+        mesh.CreateFaceVertexIndicesAttr(Vt.IntArray([0, 1, 2, 3]))
+        pointsAttr = mesh.CreatePointsAttr()
+        for frame in range(1, cls.FRAME_COUNT + 1):
+            pointsAttr.Set(Vt.Vec3fArray([
+                Gf.Vec3f(0, 0, frame), Gf.Vec3f(1, 0, frame),
+                Gf.Vec3f(1, 1, frame), Gf.Vec3f(0, 1, frame)]), frame)
+
+        stage.Save()
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls._tempDir, ignore_errors=True)
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        proxyShape = cmds.createNode('mayaUsdProxyShape')
+        cmds.setAttr('%s.filePath' % proxyShape, self._usdFilePath, type='string')
+        cmds.connectAttr('time1.outTime', '%s.time' % proxyShape)
+
+        # Play every frame, so that the time step is regular.
+        cmds.playbackOptions(minTime=1, maxTime=self.FRAME_COUNT, loop='once',
+                             playbackSpeed=0)
+        cmds.currentTime(1)
+        cmds.refresh(force=True)
+
+        PrimvarPrefetcher.ResetGlobalStats()
+
+    def testPlaybackHits(self):
+        """
+        After the first frames of playback, which give the time step, points
+        are served from the prefetched frames.
+        """
+        cmds.play(forward=True, wait=True)
+
+        stats = PrimvarPrefetcher.GetGlobalStats()
+        self.assertGreater(stats.frames, 0)
+        self.assertGreater(stats.misses, 0)
+        self.assertGreater(stats.hits, stats.misses)
+
+    def testScrubCancels(self):
+        """
+        Changing time outside of playback drops the prefetched frames, which
+        are never served.
+        """
+        cmds.play(forward=True, wait=True)
+
+        hits = PrimvarPrefetcher.GetGlobalStats().hits
+        self.assertGreater(hits, 0)
+
+        for frame in (3, 4, 8):
+            cmds.currentTime(frame)
+            cmds.refresh(force=True)
+
+        stats = PrimvarPrefetcher.GetGlobalStats()
+        self.assertEqual(stats.hits, hits)
+        self.assertEqual(stats.cancellations, 1)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
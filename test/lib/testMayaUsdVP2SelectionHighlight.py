@@ -0,0 +1,155 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import shutil
+import tempfile
+import unittest
+
+import maya.cmds as cmds
+import maya.OpenMaya as OM
+import maya.OpenMayaUI as OMUI
+from maya.app.general.mayaIsVP2Capable import mayaIsVP2Capable
+
+from mayaUsd import lib as mayaUsdLib
+
+from pxr import Gf, Usd, UsdGeom
+
+@unittest.skipIf(cmds.about(batch=True) or not mayaIsVP2Capable(),
+                 "Requires a GUI and a valid VP2")
+class testMayaUsdVP2SelectionHighlight(unittest.TestCase):
+    """
+    Tests the selection highlight of rprims in the VP2 render delegate when
+    the selection changes in the same refresh as rprims get inserted.
+    """
+
+    # Half the size of the screen area checked around a cube.
+    AREA_SIZE = 20
+
+    @classmethod
+    def setUpClass(cls):
+        cmds.loadPlugin('mayaUsdPlugin', quiet=True)
+
+        cls._tempDir = tempfile.mkdtemp()
+        cls._usdFilePath = os.path.join(cls._tempDir, 'cubes.usda')
+
+        stage = Usd.Stage.CreateNew(cls._usdFilePath)
+        cube = UsdGeom.Cube.Define(stage, '/CubeA')
+        UsdGeom.XformCommonAPI(cube).SetTranslate(Gf.Vec3d(-4, 0, 0))
+        stage.Save()
+
+    @classmethod
+    def tearDownClass(cls):
+        shutil.rmtree(cls._tempDir, ignore_errors=True)
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        proxyShape = cmds.createNode('mayaUsdProxyShape')
+        cmds.setAttr('%s.filePath' % proxyShape, self._usdFilePath, type='string')
+        self._proxyShapePath = cmds.ls(proxyShape, long=True)[0]
+        self._stage = mayaUsdLib.GetPrim(proxyShape).GetStage()
+
+        # Look at the cubes from the top, in wireframe.
+        panel = 'modelPanel4'
+        cmds.setFocus(panel)
+        cmds.lookThru(panel, 'top')
+        cmds.modelEditor(panel, edit=True, displayAppearance='wireframe')
+        cmds.setAttr('top.translate', 0, 100, 0)
+        cmds.setAttr('topShape.orthographicWidth', 20)
+        cmds.refresh(force=True)
+
+    def _Select(self, primPath):
+        cmds.select('%s,%s' % (self._proxyShapePath, primPath), replace=True)
+
+    def _DefineCube(self, primPath, x):
+        cube = UsdGeom.Cube.Define(self._stage, primPath)
+        UsdGeom.XformCommonAPI(cube).SetTranslate(Gf.Vec3d(x, 0, 0))
+
+    def _CountLeadPixels(self, x):
+        """
+        Count the pixels drawn with the lead highlight color around the cube
+        centered at x on the X axis.
+        """
+        cmds.refresh(force=True)
+
+        view = OMUI.M3dView.active3dView()
+        image = OM.MImage()
+        view.readColorBuffer(image, True)
+
+        widthUtil = OM.MScriptUtil()
+        widthPtr = widthUtil.asUintPtr()
+        heightUtil = OM.MScriptUtil()
+        heightPtr = heightUtil.asUintPtr()
+        image.getSize(widthPtr, heightPtr)
+        width = OM.MScriptUtil.getUint(widthPtr)
+        height = OM.MScriptUtil.getUint(heightPtr)
+
+        xUtil = OM.MScriptUtil()
+        xPtr = xUtil.asShortPtr()
+        yUtil = OM.MScriptUtil()
+        yPtr = yUtil.asShortPtr()
+        view.worldToView(OM.MPoint(x, 0, 0), xPtr, yPtr)
+        centerX = OM.MScriptUtil.getShort(xPtr)
+        centerY = OM.MScriptUtil.getShort(yPtr)
+
+        pixels = image.pixels()
+        count = 0
+        for py in range(max(0, centerY - self.AREA_SIZE),
+                        min(height, centerY + self.AREA_SIZE)):
+            for px in range(max(0, centerX - self.AREA_SIZE),
+                            min(width, centerX + self.AREA_SIZE)):
+                index = (py * width + px) * 4
+                r = OM.MScriptUtil.getUcharArrayItem(pixels, index)
+                g = OM.MScriptUtil.getUcharArrayItem(pixels, index + 1)
+                b = OM.MScriptUtil.getUcharArrayItem(pixels, index + 2)
+                if g > 200 and r < 100 and b < 150:
+                    count += 1
+        return count
+
+    def testSelectionMovesToInsertedPrim(self):
+        """
+        Moving the selection to a prim inserted in the same refresh, as
+        duplicating does, removes the highlight of the previous selection.
+        """
+        self._Select('/CubeA')
+        self.assertGreater(self._CountLeadPixels(-4), 0)
+
+        self._DefineCube('/CubeB', 4)
+        self._Select('/CubeB')
+
+        self.assertEqual(self._CountLeadPixels(-4), 0)
+        self.assertGreater(self._CountLeadPixels(4), 0)
+
+    def testDeselectWhileInsertingPrim(self):
+        """
+        Clearing the selection in the same refresh as a prim gets inserted
+        removes the highlight.
+        """
+        self._Select('/CubeA')
+        self.assertGreater(self._CountLeadPixels(-4), 0)
+
+        self._DefineCube('/CubeB', 4)
+        cmds.select(clear=True)
+
+        self.assertEqual(self._CountLeadPixels(-4), 0)
+        self.assertEqual(self._CountLeadPixels(4), 0)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
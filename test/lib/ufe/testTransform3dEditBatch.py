@@ -0,0 +1,189 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import maya.cmds as cmds
+
+from ufeTestUtils import usdUtils, mayaUtils
+from ufeTestUtils.testUtils import assertVectorAlmostEqual
+import mayaUsd.ufe
+import ufe
+
+from pxr import Tf, Usd
+
+import unittest
+
+class Transform3dEditBatchTestCase(unittest.TestCase):
+    '''Verify that transform edits of many items made in a batch are authored
+    together.
+
+    UFE Feature : Transform3d
+    Maya Feature : move
+    Action : Undo and redo of a relative move of multiple USD items, in a
+        transform edit batch.
+    Applied On Selection :
+        - Multiple Selection [Non-Maya].
+    Undo/Redo Test : Yes
+    Expect Results To Test :
+        - A single ObjectsChanged notice for all the items.
+        - A single ObjectsChanged notice for all the items per manipulation
+          tick, without an explicit batch.
+        - USD object translation of each item.
+    Edge Cases :
+        - None.
+    '''
+
+    pluginsLoaded = False
+
+    @classmethod
+    def setUpClass(cls):
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    def setUp(self):
+        ''' Called initially to set up the maya test environment '''
+        # Load plugins
+        self.assertTrue(self.pluginsLoaded)
+
+        # Open top_layer.ma scene in test-samples
+        mayaUtils.openTopLayerScene()
+
+        # Clear selection to start off
+        cmds.select(clear=True)
+
+        self.noticeCount = 0
+
+    def _OnObjectsChanged(self, notice, sender):
+        self.noticeCount += 1
+
+    def testBatchedUndoRedo(self):
+        '''Undo and redo of a multi-item move send a single notice in a batch.'''
+
+        proxyShapePathSegment = mayaUtils.createUfePathSegment(
+            "|world|transform1|proxyShape1")
+        stage = mayaUsd.ufe.getStage(str(proxyShapePathSegment))
+
+        balls = ['Ball_33', 'Ball_34', 'Ball_35']
+        ballItems = [
+            ufe.Hierarchy.createItem(ufe.Path([proxyShapePathSegment,
+                usdUtils.createUfePathSegment('/Room_set/Props/' + ball)]))
+            for ball in balls]
+
+        for ballItem in ballItems:
+            ufe.GlobalSelection.get().append(ballItem)
+
+        def translations():
+            return [usdUtils.getPrimFromSceneItem(item).GetAttribute(
+                'xformOp:translate').Get() for item in ballItems]
+
+        # Move once outside of a batch, which adds the translate ops.
+        cmds.move(1, 2, 3, relative=True)
+        previous = translations()
+        cmds.move(4, 5, 6, relative=True)
+        moved = translations()
+
+        listener = Tf.Notice.Register(
+            Usd.Notice.ObjectsChanged, self._OnObjectsChanged, stage)
+
+        # Queued values are authored when the batch expires, in a single
+        # notice for all the items.
+        self.noticeCount = 0
+        with mayaUsd.ufe.Transform3dEditBatch():
+            self.assertTrue(mayaUsd.ufe.Transform3dEditBatch.inBatch())
+            cmds.undo()
+            self.assertEqual(self.noticeCount, 0)
+        self.assertFalse(mayaUsd.ufe.Transform3dEditBatch.inBatch())
+        self.assertEqual(self.noticeCount, 1)
+        for expected, actual in zip(previous, translations()):
+            assertVectorAlmostEqual(self, expected, actual)
+
+        self.noticeCount = 0
+        with mayaUsd.ufe.Transform3dEditBatch():
+            cmds.redo()
+        self.assertEqual(self.noticeCount, 1)
+        for expected, actual in zip(moved, translations()):
+            assertVectorAlmostEqual(self, expected, actual)
+
+        # Each item still undoes and redoes on its own outside of a batch.
+        cmds.undo()
+        for expected, actual in zip(previous, translations()):
+            assertVectorAlmostEqual(self, expected, actual)
+        cmds.redo()
+        for expected, actual in zip(moved, translations()):
+            assertVectorAlmostEqual(self, expected, actual)
+
+        listener.Revoke()
+
+    @unittest.skipIf(cmds.about(apiVersion=True) < 20190000,
+        'Authoring queued values on idle requires Maya 2019 or later.')
+    def testManipulationTicks(self):
+        '''Repeated moves of many items are authored together per tick.'''
+
+        proxyShapePathSegment = mayaUtils.createUfePathSegment(
+            "|world|transform1|proxyShape1")
+        stage = mayaUsd.ufe.getStage(str(proxyShapePathSegment))
+
+        balls = ['Ball_33', 'Ball_34', 'Ball_35']
+        ballItems = [
+            ufe.Hierarchy.createItem(ufe.Path([proxyShapePathSegment,
+                usdUtils.createUfePathSegment('/Room_set/Props/' + ball)]))
+            for ball in balls]
+
+        # As the move manipulator does, create a command per item and set
+        # its value once, which adds the translate op.
+        translateCmds = [ufe.Transform3d.transform3d(item).translateCmd()
+                         for item in ballItems]
+        for translateCmd in translateCmds:
+            translateCmd.translate(1, 2, 3)
+
+        listener = Tf.Notice.Register(
+            Usd.Notice.ObjectsChanged, self._OnObjectsChanged, stage)
+
+        for tick in range(1, 4):
+            expected = [1, 2, 3 + tick]
+
+            # Values set while dragging are queued, no batch being open...
+            self.noticeCount = 0
+            for translateCmd in translateCmds:
+                translateCmd.translate(*expected)
+            self.assertFalse(mayaUsd.ufe.Transform3dEditBatch.inBatch())
+            self.assertTrue(mayaUsd.ufe.Transform3dEditBatch.hasQueuedValues())
+            self.assertEqual(self.noticeCount, 0)
+
+            # ... but read back by the transform interface.
+            for item in ballItems:
+                assertVectorAlmostEqual(self, expected,
+                    ufe.Transform3d.transform3d(item).translation().vector)
+
+            # They are authored on idle, in a single notice for all the
+            # items.
+            cmds.flushIdleQueue()
+            self.assertFalse(mayaUsd.ufe.Transform3dEditBatch.hasQueuedValues())
+            self.assertEqual(self.noticeCount, 1)
+            for item in ballItems:
+                assertVectorAlmostEqual(self, expected,
+                    usdUtils.getPrimFromSceneItem(item).GetAttribute(
+                        'xformOp:translate').Get())
+
+        # Reading the matrix of an item authors the queued values first.
+        for translateCmd in translateCmds:
+            translateCmd.translate(7, 8, 9)
+        self.assertTrue(mayaUsd.ufe.Transform3dEditBatch.hasQueuedValues())
+        ufe.Transform3d.transform3d(ballItems[0]).inclusiveMatrix()
+        self.assertFalse(mayaUsd.ufe.Transform3dEditBatch.hasQueuedValues())
+
+        listener.Revoke()
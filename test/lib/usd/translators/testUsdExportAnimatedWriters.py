@@ -0,0 +1,190 @@
+#!/pxrpythonsubst
+#
+# Copyright 2020 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import os
+import re
+import unittest
+
+from pxr import Usd
+from pxr import UsdGeom
+
+from maya import cmds
+from maya import standalone
+from maya.api import OpenMaya as OM
+
+import fixturesUtils
+
+class testUsdExportAnimatedWriters(unittest.TestCase):
+    """
+    Tests that the export job only writes time samples for prims whose Maya
+    nodes are animated, while static nodes are still written at default time.
+    """
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        cmds.file(new=True, force=True)
+
+        cmds.polyCube(name='StaticCube')
+        cmds.setAttr('StaticCube.translateX', 2.0)
+
+        cmds.polyCube(name='AnimatedCube')
+        cmds.setKeyframe('AnimatedCube.translateY', time=1, value=0.0)
+        cmds.setKeyframe('AnimatedCube.translateY', time=5, value=4.0)
+
+        # Only the transform's visibility is animated, but with merged
+        # transforms and shapes the shape writer authors visibility.
+        cmds.polyCube(name='VisAnimatedCube')
+        cmds.setKeyframe('VisAnimatedCube.visibility', time=1, value=1)
+        cmds.setKeyframe('VisAnimatedCube.visibility', time=5, value=0)
+
+    def _Export(self, fileName):
+        usdFilePath = os.path.abspath(fileName)
+        cmds.usdExport(file=usdFilePath, frameRange=(1, 5),
+            exportVisibility=True)
+        stage = Usd.Stage.Open(usdFilePath)
+        self.assertTrue(stage)
+        return stage
+
+    def testStaticPrimsHaveNoTimeSamples(self):
+        stage = self._Export('StaticCube.usda')
+
+        xformable = UsdGeom.Xformable(stage.GetPrimAtPath('/StaticCube'))
+        self.assertFalse(xformable.TransformMightBeTimeVarying())
+        self.assertEqual(
+            xformable.GetLocalTransformation(Usd.TimeCode.Default())[3][0],
+            2.0)
+
+        mesh = UsdGeom.Mesh(stage.GetPrimAtPath('/StaticCube'))
+        self.assertEqual(mesh.GetPointsAttr().GetNumTimeSamples(), 0)
+        self.assertTrue(mesh.GetPointsAttr().HasAuthoredValue())
+
+    def testAnimatedPrimsAreWrittenPerFrame(self):
+        stage = self._Export('AnimatedCube.usda')
+
+        xformable = UsdGeom.Xformable(stage.GetPrimAtPath('/AnimatedCube'))
+        self.assertTrue(xformable.TransformMightBeTimeVarying())
+        self.assertEqual(
+            xformable.GetLocalTransformation(Usd.TimeCode(5.0))[3][1], 4.0)
+
+    def testParentVisibilityAnimation(self):
+        stage = self._Export('VisAnimatedCube.usda')
+
+        imageable = UsdGeom.Imageable(
+            stage.GetPrimAtPath('/VisAnimatedCube'))
+        self.assertEqual(
+            imageable.ComputeVisibility(Usd.TimeCode(1.0)),
+            UsdGeom.Tokens.inherited)
+        self.assertEqual(
+            imageable.ComputeVisibility(Usd.TimeCode(5.0)),
+            UsdGeom.Tokens.invisible)
+
+    def testConnectedStaticChannels(self):
+        """
+        A channel driven by a static utility node is sampled per frame, so its
+        writer must not be culled even though nothing upstream is animated.
+        """
+        multiplyDivide = cmds.createNode('multiplyDivide')
+        cmds.setAttr('%s.input1X' % multiplyDivide, 3.0)
+        cmds.connectAttr('%s.outputX' % multiplyDivide,
+            'StaticCube.translateZ')
+
+        stage = self._Export('DrivenCube.usda')
+
+        xformable = UsdGeom.Xformable(stage.GetPrimAtPath('/StaticCube'))
+        for frame in (1.0, 5.0):
+            translation = xformable.GetLocalTransformation(
+                Usd.TimeCode(frame)).ExtractTranslation()
+            self.assertEqual(translation[0], 2.0)
+            self.assertEqual(translation[2], 3.0)
+
+    def testConnectedUserExportedAttributes(self):
+        """
+        A user-exported attribute driven by a static utility node is only
+        written at time samples, so its writer must not be culled either.
+        """
+        cmds.addAttr('StaticCubeShape', longName='drivenAttr',
+            attributeType='double')
+        cmds.addAttr('StaticCubeShape',
+            longName='USD_UserExportedAttributesJson', dataType='string')
+        cmds.setAttr('StaticCubeShape.USD_UserExportedAttributesJson',
+            '{"drivenAttr": {}}', type='string')
+
+        multiplyDivide = cmds.createNode('multiplyDivide')
+        cmds.setAttr('%s.input1X' % multiplyDivide, 3.0)
+        cmds.connectAttr('%s.outputX' % multiplyDivide,
+            'StaticCubeShape.drivenAttr')
+
+        stage = self._Export('DrivenUserAttribute.usda')
+
+        attr = stage.GetPrimAtPath('/StaticCube').GetAttribute(
+            'userProperties:drivenAttr')
+        self.assertTrue(attr)
+        for frame in (1.0, 5.0):
+            self.assertEqual(attr.Get(Usd.TimeCode(frame)), 3.0)
+
+    def _OnCommandOutput(self, message, messageType, _):
+        if messageType == OM.MCommandMessage.kInfo:
+            self.messageLog.append(message)
+
+    def _ExportAndCountWriters(self, fileName):
+        """
+        Exports verbosely and returns the number of animated prim writers and
+        the total number of prim writers reported by the write job.
+        """
+        self.messageLog = []
+        callback = OM.MCommandMessage.addCommandOutputCallback(
+            self._OnCommandOutput)
+        try:
+            cmds.usdExport(file=os.path.abspath(fileName), frameRange=(1, 5),
+                verbose=True)
+        finally:
+            OM.MMessage.removeCallback(callback)
+
+        for message in self.messageLog:
+            match = re.search(r'(\d+) of (\d+) prim writers are animated',
+                message)
+            if match:
+                return int(match.group(1)), int(match.group(2))
+
+        self.fail('Write job did not report its animated prim writers')
+
+    def testStaticWritersAreCulled(self):
+        """
+        Static prims are not visited per frame: adding them to the scene adds
+        prim writers without adding animated ones.
+        """
+        cmds.delete('StaticCube', 'VisAnimatedCube')
+        animated, total = self._ExportAndCountWriters('AnimatedOnly.usda')
+        self.assertGreater(animated, 0)
+
+        for i in range(3):
+            cmds.polyCube(name='ExtraStaticCube%d' % i)
+        animatedWithStatic, totalWithStatic = self._ExportAndCountWriters(
+            'AnimatedWithStatic.usda')
+        self.assertEqual(animatedWithStatic, animated)
+        self.assertGreater(totalWithStatic, total)
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)